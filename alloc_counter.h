@@ -0,0 +1,11 @@
+#ifndef alloc_counter_h
+#define alloc_counter_h
+
+#include <cstddef>
+
+// Number of global operator new calls since startup. alloc_counter.cpp
+// replaces operator new/delete to count them, so the render loop can show
+// how many heap allocations a frame made (it should be zero once running).
+std::size_t allocationCount();
+
+#endif /* alloc_counter_h */
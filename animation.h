@@ -0,0 +1,146 @@
+#ifndef animation_h
+#define animation_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// what an animated value does when it reaches an end of its range
+enum AnimationEnds {
+    ANIMATION_CLAMP,    // stops there
+    ANIMATION_BOUNCE,   // turns around, for parts a held key swings back and forth
+    ANIMATION_WRAP      // starts over at the other end, for things that spin
+};
+
+// The moving parts of the scene, stepped at a fixed rate apart from drawing.
+// Each animation drives one float the draw code already reads (the gate's
+// gateOpenCurrent, a door's angle, ...). Input and the scene's triggers only
+// say which way a value should go with drive(); advance() then moves every
+// driven value rate units per second of simulated time, in as many fixed
+// steps as the frame's deltaTime covers, so nothing moves faster on a faster
+// machine.
+//
+// advance() marks the animations whose value it changed. changed() lets the
+// code that derives something from a value (wheel placements, a re-recorded
+// prototype) skip it on the frames where nothing moved.
+class AnimationSystem {
+public:
+    static constexpr float step = 1.0f / 60.0f;
+    // after a long stall (loading, a breakpoint) the parts jump ahead at most
+    // this many steps instead of replaying all of it in one frame
+    static const int maxSteps = 8;
+
+    // value starts where it is; rate is in units per second
+    int add(float* value, float low, float high, float rate, AnimationEnds ends = ANIMATION_CLAMP)
+    {
+        Animation animation;
+        animation.value = value;
+        animation.low = low;
+        animation.high = high;
+        animation.rate = rate;
+        animation.ends = ends;
+        animations.push_back(animation);
+        return (int)animations.size() - 1;
+    }
+
+    // direction is +1 towards high, -1 towards low and 0 to hold still; a
+    // bouncing value only cares whether it is driven, it keeps its heading
+    void drive(int id, float direction)
+    {
+        animations[id].direction = direction;
+    }
+
+    // steps every driven value through deltaTime seconds; the count is how many
+    // animations changed
+    int advance(float deltaTime)
+    {
+        for (Animation& animation : animations)
+            animation.dirty = false;
+        accumulator += deltaTime;
+        int steps = 0;
+        while (accumulator >= step && steps < maxSteps)
+        {
+            for (Animation& animation : animations)
+                if (animation.direction != 0.0f)
+                    stepAnimation(animation);
+            accumulator -= step;
+            steps++;
+        }
+        if (steps == maxSteps)
+            accumulator = std::min(accumulator, step);
+
+        int count = 0;
+        for (const Animation& animation : animations)
+            if (animation.dirty)
+                count++;
+        changedLastAdvance = count;
+        return count;
+    }
+
+    bool changed(int id) const
+    {
+        return animations[id].dirty;
+    }
+
+    int changedCount() const
+    {
+        return changedLastAdvance;
+    }
+
+    int size() const
+    {
+        return (int)animations.size();
+    }
+
+private:
+    struct Animation {
+        float* value = nullptr;
+        float low = 0.0f;
+        float high = 0.0f;
+        float rate = 0.0f;
+        AnimationEnds ends = ANIMATION_CLAMP;
+        float direction = 0.0f;
+        float heading = 1.0f;   // where a bouncing value is going
+        bool dirty = false;
+    };
+
+    std::vector<Animation> animations;
+    float accumulator = 0.0f;
+    int changedLastAdvance = 0;
+
+    static void stepAnimation(Animation& animation)
+    {
+        float before = *animation.value;
+        float distance = animation.rate * step;
+        float next;
+        switch (animation.ends)
+        {
+        case ANIMATION_BOUNCE:
+            next = before + animation.heading * distance;
+            if (next >= animation.high)
+            {
+                next = animation.high;
+                animation.heading = -1.0f;
+            }
+            else if (next <= animation.low)
+            {
+                next = animation.low;
+                animation.heading = 1.0f;
+            }
+            break;
+        case ANIMATION_WRAP:
+            next = animation.low + std::fmod(before + animation.direction * distance - animation.low + (animation.high - animation.low), animation.high - animation.low);
+            break;
+        default:
+            next = std::max(animation.low, std::min(animation.high, before + animation.direction * distance));
+            break;
+        }
+        if (next != before)
+        {
+            *animation.value = next;
+            animation.dirty = true;
+        }
+    }
+};
+
+#endif /* animation_h */
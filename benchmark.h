@@ -0,0 +1,303 @@
+#ifndef benchmark_h
+#define benchmark_h
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#ifdef __linux__
+#define EGL_NO_X11
+#define MESA_EGL_NO_X11_HEADERS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+// Recorded camera flight for --benchmark. The file has one key per line,
+// "time x y z yaw pitch" with time in seconds, and # starts a comment.
+// Between keys the camera follows a Catmull-Rom spline, so it passes through
+// every key without stopping at them.
+class CameraPath {
+public:
+    bool load(const char* path)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return false;
+        keys.clear();
+        std::string line;
+        while (std::getline(file, line))
+        {
+            line = line.substr(0, line.find('#'));
+            Key key;
+            std::istringstream fields(line);
+            if (fields >> key.time >> key.position.x >> key.position.y >> key.position.z >> key.yaw >> key.pitch)
+                keys.push_back(key);
+        }
+        // a path needs somewhere to go, and keys out of order would run it backwards
+        if (keys.size() < 2)
+            return false;
+        for (size_t i = 1; i < keys.size(); i++)
+            if (keys[i].time <= keys[i - 1].time)
+                return false;
+        return true;
+    }
+
+    float duration() const
+    {
+        return keys.empty() ? 0.0f : keys.back().time;
+    }
+
+    void sample(float time, glm::vec3& position, float& yaw, float& pitch) const
+    {
+        size_t segment = 0;
+        while (segment + 2 < keys.size() && time >= keys[segment + 1].time)
+            segment++;
+        const Key& k0 = keys[segment == 0 ? 0 : segment - 1];
+        const Key& k1 = keys[segment];
+        const Key& k2 = keys[segment + 1];
+        const Key& k3 = keys[std::min(segment + 2, keys.size() - 1)];
+        float t = std::max(0.0f, std::min(1.0f, (time - k1.time) / (k2.time - k1.time)));
+
+        position = catmullRom(k0.position, k1.position, k2.position, k3.position, t);
+        yaw = catmullRom(k0.yaw, k1.yaw, k2.yaw, k3.yaw, t);
+        pitch = catmullRom(k0.pitch, k1.pitch, k2.pitch, k3.pitch, t);
+    }
+
+private:
+    struct Key {
+        float time;
+        glm::vec3 position;
+        float yaw;
+        float pitch;
+    };
+
+    std::vector<Key> keys;
+
+    template <typename T>
+    static T catmullRom(const T& p0, const T& p1, const T& p2, const T& p3, float t)
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        return ((p1 * 2.0f) + (p2 - p0) * t + (p0 * 2.0f - p1 * 5.0f + p2 * 4.0f - p3) * t2 + (p3 - p0 + (p1 - p2) * 3.0f) * t3) * 0.5f;
+    }
+};
+
+// GL_TIME_ELAPSED queries around whole frames. The result of a frame is read
+// latency frames later, by then the GPU has normally finished it and reading
+// does not stall the pipeline the way reading it straight away would.
+class GpuFrameTimer {
+public:
+    static const int latency = 4;
+
+    void create()
+    {
+        glGenQueries(latency, queries);
+    }
+
+    void destroy()
+    {
+        glDeleteQueries(latency, queries);
+    }
+
+    void begin(int frame)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, queries[frame % latency]);
+    }
+
+    void end()
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+    }
+
+    // milliseconds the GPU spent on frame, waits for it if it is still running
+    double result(int frame)
+    {
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(queries[frame % latency], GL_QUERY_RESULT, &nanoseconds);
+        return nanoseconds / 1.0e6;
+    }
+
+private:
+    GLuint queries[latency];
+};
+
+// what one benchmark frame cost
+struct BenchmarkFrame {
+    double cpuMs = 0.0;
+    double gpuMs = 0.0;
+    int drawCalls = 0;
+    long long triangles = 0;
+    int stateChanges = 0;
+    int stateChangesElided = 0;
+    int culled = 0;
+    int visibleCells = 0;
+};
+
+// All frames of a run, written out as CSV with min/median/p99 of the timings.
+// The first warmupFrames are in the CSV but left out of the summary.
+class BenchmarkLog {
+public:
+    std::vector<BenchmarkFrame> frames;
+    int warmupFrames = 0;
+
+    bool writeCsv(const char* path) const
+    {
+        std::ofstream csv(path);
+        if (!csv)
+            return false;
+        csv << "frame,warmup,cpu_ms,gpu_ms,draw_calls,triangles,state_changes,state_changes_elided,culled,visible_cells\n";
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            const BenchmarkFrame& frame = frames[i];
+            csv << i << ',' << ((int)i < warmupFrames) << ',' << frame.cpuMs << ',' << frame.gpuMs << ',' << frame.drawCalls << ',' << frame.triangles << ','
+                << frame.stateChanges << ',' << frame.stateChangesElided << ',' << frame.culled << ',' << frame.visibleCells << '\n';
+        }
+        return true;
+    }
+
+    void printSummary(std::ostream& out) const
+    {
+        if ((int)frames.size() <= warmupFrames)
+            return;
+        std::vector<double> cpu, gpu, draws, triangles, states;
+        for (size_t i = warmupFrames; i < frames.size(); i++)
+        {
+            const BenchmarkFrame& frame = frames[i];
+            cpu.push_back(frame.cpuMs);
+            gpu.push_back(frame.gpuMs);
+            draws.push_back(frame.drawCalls);
+            triangles.push_back((double)frame.triangles);
+            states.push_back(frame.stateChanges);
+        }
+        out << cpu.size() << " frames              min      median         p99" << std::endl;
+        printRow(out, "cpu ms        ", cpu);
+        printRow(out, "gpu ms        ", gpu);
+        printRow(out, "draw calls    ", draws);
+        printRow(out, "triangles     ", triangles);
+        printRow(out, "state changes ", states);
+    }
+
+private:
+    static void printRow(std::ostream& out, const char* name, std::vector<double>& values)
+    {
+        std::sort(values.begin(), values.end());
+        char row[128];
+        snprintf(row, sizeof(row), "%s %11.3f %11.3f %11.3f", name, values.front(), percentile(values, 0.5), percentile(values, 0.99));
+        out << row << std::endl;
+    }
+
+    // nearest rank on sorted values
+    static double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        size_t rank = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+};
+
+// GL 3.3 core context without a window, drawing into its own framebuffer of
+// width x height. On Linux this is an EGL surfaceless context, which Mesa's
+// llvmpipe provides on machines without a GPU or display; elsewhere it falls
+// back to a hidden GLFW window. glad is loaded once the context is current.
+class HeadlessContext {
+public:
+    bool create(int width, int height)
+    {
+#ifdef __linux__
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay != NULL)
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (display == EGL_NO_DISPLAY)
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        EGLint major, minor;
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor) || !eglBindAPI(EGL_OPENGL_API))
+        {
+            std::cout << "Failed to initialize EGL" << std::endl;
+            return false;
+        }
+        const EGLint attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+        if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+        {
+            std::cout << "Failed to create a surfaceless EGL context" << std::endl;
+            return false;
+        }
+        if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+#else
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        window = glfwCreateWindow(width, height, "Hospital-1907086 benchmark", NULL, NULL);
+        if (window == NULL)
+        {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            return false;
+        }
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+#endif
+        {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return false;
+        }
+
+        glGenFramebuffers(1, &framebuffer);
+        glGenRenderbuffers(1, &colorBuffer);
+        glGenRenderbuffers(1, &depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            std::cout << "Offscreen framebuffer is incomplete" << std::endl;
+            return false;
+        }
+        glViewport(0, 0, width, height);
+        return true;
+    }
+
+    void destroy()
+    {
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(1, &colorBuffer);
+        glDeleteRenderbuffers(1, &depthBuffer);
+#ifdef __linux__
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(display, context);
+        eglTerminate(display);
+#else
+        glfwTerminate();
+#endif
+    }
+
+private:
+#ifdef __linux__
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+#else
+    GLFWwindow* window = NULL;
+#endif
+    GLuint framebuffer = 0;
+    GLuint colorBuffer = 0;
+    GLuint depthBuffer = 0;
+};
+
+#endif /* benchmark_h */
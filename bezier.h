@@ -49,17 +49,17 @@ public:
         lightingShader.setFloat("material.shininess", 32.0f);
         lightingShader.setMat4("model", model);
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, texture);
 
-        glBindVertexArray(sphereVAO);
-        glDrawElements(GL_TRIANGLES,                    // primitive type
+        bindVertexArray(sphereVAO);
+        drawElements(GL_TRIANGLES,                    // primitive type
             (unsigned int)indices.size(),          // # of indices
             GL_UNSIGNED_INT,                 // data type
             (void*)0);                       // offset to indices
 
         // unbind VAO
-        glBindVertexArray(0);
+        bindVertexArray(0);
     }
 
 private:
@@ -200,7 +200,7 @@ private:
 
         unsigned int bezierVAO;
         glGenVertexArrays(1, &bezierVAO);
-        glBindVertexArray(bezierVAO);
+        bindVertexArray(bezierVAO);
 
         // create VBO to copy vertex data to VBO
         unsigned int bezierVBO;
@@ -232,7 +232,7 @@ private:
         glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 6));
 
         // unbind VAO, VBO and EBO
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -9,6 +9,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "frustum.h"
 
 using namespace std;
 
@@ -31,6 +32,7 @@ public:
     vector <int> indices;
     vector <float> vertices;
     const double pi = 3.14159265389;
+    BoundingBox localBounds;
     // ctor/dtor
     Bezier(float cPoints[], int sz, glm::vec3 amb = glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3 diff = glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3 spec = glm::vec3(0.5f, 0.5f, 0.5f), float shiny = 32.0f)
     {
@@ -44,9 +46,16 @@ public:
         this->shininess = shiny;
 
         bezierVAO = hollowBezier(cntrlPoints.data(), ((unsigned int)cntrlPoints.size() / 3) - 1);
+        for (size_t i = 0; i + 2 < coordinates.size(); i += 3)
+            localBounds.expand(glm::vec3(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
     }
     ~Bezier() {}
     // getters/setters
+    // world box of the surface drawBezier(shader, model) draws
+    BoundingBox bounds(glm::mat4 model) const
+    {
+        return localBounds.transformed(model);
+    }
 
     // draw in VertexArray mode
     void drawBezier(Shader& lightingShader, glm::mat4 model) const      // draw surface
@@ -59,14 +68,14 @@ public:
         lightingShader.setFloat("material.shininess", this->shininess);
 
         lightingShader.setMat4("model", model);
-        glBindVertexArray(bezierVAO);
-        glDrawElements(GL_TRIANGLES,                    // primitive type
+        bindVertexArray(bezierVAO);
+        drawElements(GL_TRIANGLES,                    // primitive type
             (unsigned int)indices.size(),          // # of indices
             GL_UNSIGNED_INT,                 // data type
             (void*)0);                       // offset to indices
 
         // unbind VAO
-        glBindVertexArray(0);
+        bindVertexArray(0);
     }
     // member functions
     long long nCr(int n, int r)
@@ -220,7 +229,7 @@ public:
 
         unsigned int bezierVAO;
         glGenVertexArrays(1, &bezierVAO);
-        glBindVertexArray(bezierVAO);
+        bindVertexArray(bezierVAO);
 
         // create VBO to copy vertex data to VBO
         unsigned int bezierVBO;
@@ -252,7 +261,7 @@ public:
         glVertexAttribPointer(2, 2, GL_FLOAT, false, stride, (void*)(sizeof(float) * 6));
 
         // unbind VAO, VBO and EBO
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -44,7 +44,7 @@ public:
 
         lightingShader.setMat4("model", model);
         glBindVertexArray(bezierVAO);
-        glDrawElements(GL_TRIANGLES, (unsigned int)indices.size(), GL_UNSIGNED_INT, (void*)0);
+        drawElements(GL_TRIANGLES, (unsigned int)indices.size(), GL_UNSIGNED_INT, (void*)0);
         glBindVertexArray(0);
     }
 
@@ -99,6 +99,15 @@ public:
         LOOKAT = Position + Front;
     }
 
+    // places the camera directly, used when replaying a recorded path
+    void SetPose(glm::vec3 position, float yaw, float pitch)
+    {
+        Position = position;
+        Yaw = yaw;
+        Pitch = pitch;
+        updateCameraVectors();
+    }
+
     void ProcessYPR(float xoffset, float yoffset, float rll)
     {
         xoffset *= MouseSensitivity;
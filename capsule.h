@@ -7,6 +7,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "primitive_mesh.h"
 #define PI 3.141516
 
 class Capsule {
@@ -38,15 +39,8 @@ public:
         this->specular = spec;
         this->shininess = shiny;
 
-        generateCapsuleVerticesAndIndices();
-        setupCapsuleVAO();
-    }
-
-    // Destructor
-    ~Capsule() {
-        glDeleteVertexArrays(1, &capsuleVAO);
-        glDeleteBuffers(1, &capsuleVBO);
-        glDeleteBuffers(1, &capsuleEBO);
+        PrimitiveKey key = { PrimitiveKey::CAPSULE, 36, 18, 1.0f, 0.0f };
+        mesh = PrimitiveMeshRegistry::shared().acquire(key, generateCapsuleVerticesAndIndices);
     }
 
     void draw(Shader& shader, glm::mat4 model = glm::mat4(1.0f)) {
@@ -57,7 +51,7 @@ public:
         shader.setVec3("material.specular", this->specular);
         shader.setFloat("material.shininess", this->shininess);
 
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
 
         transform = positionMatrix * rotationMatrix * scaleMatrix;
         model = model * transform;
@@ -67,10 +61,9 @@ public:
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-        glBindVertexArray(capsuleVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
 
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
@@ -91,18 +84,19 @@ public:
         rotationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), axis);
     }
 
-private:
-    unsigned int capsuleVAO;
-    unsigned int capsuleVBO;
-    unsigned int capsuleEBO;
+    // world box of what draw(shader, model) covers
+    BoundingBox bounds(glm::mat4 model = glm::mat4(1.0f)) const
+    {
+        return mesh.bounds.transformed(model * positionMatrix * rotationMatrix * scaleMatrix);
+    }
 
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
+private:
+    PrimitiveMesh mesh;
 
-    void generateCapsuleVerticesAndIndices() {
-        const int sectors = 36;
-        const int stacks = 18;
-        const float radius = 1.0f;
+    static void generateCapsuleVerticesAndIndices(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices) {
+        const int sectors = key.sectors;
+        const int stacks = key.stacks;
+        const float radius = key.radius;
         const float height = 2.0f;
         const float halfHeight = height / 2.0f;
 
@@ -199,31 +193,6 @@ private:
             }
         }
     }
-
-    void setupCapsuleVAO() {
-        glGenVertexArrays(1, &capsuleVAO);
-        glGenBuffers(1, &capsuleVBO);
-        glGenBuffers(1, &capsuleEBO);
-
-        glBindVertexArray(capsuleVAO);
-
-        glBindBuffer(GL_ARRAY_BUFFER, capsuleVBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, capsuleEBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-        glEnableVertexAttribArray(2);
-
-        glBindVertexArray(0);
-    }
 };
 
 #endif /* CAPSULE_H */
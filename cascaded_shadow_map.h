@@ -0,0 +1,314 @@
+#ifndef cascaded_shadow_map_h
+#define cascaded_shadow_map_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <iostream>
+#include "shader.h"
+#include "frustum.h"
+#include "gl_handle.h"
+#include "render_state.h"
+
+// Shadows of the directional light. The camera's view out to shadowDistance
+// is cut into cascades, the near ones covering less ground with as many
+// texels, and every cascade is drawn along the light into its own layer of a
+// depth texture array. fragmentShader.fs picks a fragment's cascade by its
+// view depth and filters the layer with 3x3 PCF.
+//
+// Nearly everything that casts a shadow is in the static batch, so each
+// cascade has two layers. The static layer holds only what never moves and is
+// drawn again only when the cascade's window moves or the light turns; the
+// live layer, which the shaders read, is the static layer copied over every
+// frame with the moving parts drawn on top.
+//
+// A cascade's window is a square around the bounding sphere of its slice of
+// the view, so turning the camera never changes its size, grown by a margin
+// and moved in steps of twice that margin (whole texels, so edges do not
+// crawl). Walking around then re-renders a static layer once every few
+// metres instead of every frame.
+class CascadedShadowMap {
+public:
+    static const int cascades = 3;
+    static const int size = 1024;
+    // the shadow map goes after the overdraw counts (overdraw_view.h)
+    static const int unit = 11;
+    // no shadows beyond this view depth
+    static constexpr float shadowDistance = 60.0f;
+    // between even (0) and logarithmic (1) split distances
+    static constexpr float splitBlend = 0.75f;
+    // how much a window grows past the sphere, as a part of its radius
+    static constexpr float margin = 0.25f;
+
+    CascadedShadowMap()
+    {
+        glGenTextures(1, &staticDepth);
+        glGenTextures(1, &liveDepth);
+        glGenFramebuffers(cascades, staticBuffers);
+        glGenFramebuffers(cascades, liveBuffers);
+
+        GLint previous = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+        activeTexture(GL_TEXTURE0 + unit);
+        allocate(staticDepth, staticBuffers);
+        allocate(liveDepth, liveBuffers);
+        // the shaders compare against the live layers, with the 2x2 filter
+        // of a shadow sampler under every PCF tap
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        activeTexture(GL_TEXTURE0);
+        glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    }
+
+    ~CascadedShadowMap()
+    {
+        deleteTextures(1, &staticDepth);
+        deleteTextures(1, &liveDepth);
+        glDeleteFramebuffers(cascades, staticBuffers);
+        glDeleteFramebuffers(cascades, liveBuffers);
+    }
+
+    CascadedShadowMap(const CascadedShadowMap&) = delete;
+    CascadedShadowMap& operator=(const CascadedShadowMap&) = delete;
+
+    // points a lit shader's sampler at the shadow map; shader must be in use
+    void attach(const Shader& shader) const
+    {
+        shader.setInt("shadowMap", unit);
+    }
+
+    // world box of everything that casts, the depth range of every window
+    void setCasters(const BoundingBox& box)
+    {
+        casters = box;
+        invalidate();
+    }
+
+    // the static layers are drawn again at the next update
+    void invalidate()
+    {
+        for (Cascade& cascade : cascadeData)
+            cascade.cached = false;
+    }
+
+    // places the cascades for the camera's view and the light's direction;
+    // the count is how many static layers are out of date
+    int update(const glm::mat4& view, float fovy, float aspect, float nearPlane, const glm::vec3& direction)
+    {
+        if (direction != lightDirection)
+        {
+            lightDirection = direction;
+            glm::vec3 forward = glm::normalize(direction);
+            glm::vec3 up = std::fabs(forward.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            lightView = glm::lookAt(glm::vec3(0.0f), forward, up);
+            // every caster lies between the window's near and far planes
+            depthNear = FLT_MAX;
+            depthFar = -FLT_MAX;
+            for (int corner = 0; corner < 8; corner++)
+            {
+                glm::vec3 point((corner & 1) ? casters.max.x : casters.min.x, (corner & 2) ? casters.max.y : casters.min.y,
+                    (corner & 4) ? casters.max.z : casters.min.z);
+                float depth = -(lightView * glm::vec4(point, 1.0f)).z;
+                depthNear = std::min(depthNear, depth - 1.0f);
+                depthFar = std::max(depthFar, depth + 1.0f);
+            }
+            invalidate();
+        }
+
+        glm::mat4 cameraWorld = glm::inverse(view);
+        glm::vec3 eye = glm::vec3(cameraWorld[3]);
+        glm::vec3 front = -glm::vec3(cameraWorld[2]);
+        float tanY = std::tan(fovy * 0.5f);
+        float tanX = tanY * aspect;
+        float start = nearPlane;
+        staleCount = 0;
+        for (int i = 0; i < cascades; i++)
+        {
+            Cascade& cascade = cascadeData[i];
+            float part = (float)(i + 1) / cascades;
+            float even = nearPlane + (shadowDistance - nearPlane) * part;
+            float logarithmic = nearPlane * std::pow(shadowDistance / nearPlane, part);
+            cascade.end = even + (logarithmic - even) * splitBlend;
+
+            // the slice's sphere sits on the view axis where its near and far
+            // corners are equally far away, or at the far plane's centre if
+            // that is further than the far plane
+            float reach = tanX * tanX + tanY * tanY;
+            float along = std::min(cascade.end, 0.5f * (start + cascade.end) * (1.0f + reach));
+            float radius = std::sqrt(std::max((along - start) * (along - start) + start * start * reach,
+                (cascade.end - along) * (cascade.end - along) + cascade.end * cascade.end * reach));
+            // rounded up to a size that survives floating point noise
+            radius = std::ceil(radius * 16.0f) / 16.0f;
+            float halfSize = radius * (1.0f + margin);
+            float texel = 2.0f * halfSize / size;
+            float step = std::max(texel, std::floor(2.0f * radius * margin / texel) * texel);
+
+            glm::vec3 center = glm::vec3(lightView * glm::vec4(eye + front * along, 1.0f));
+            glm::vec2 window(std::floor(center.x / step + 0.5f) * step, std::floor(center.y / step + 0.5f) * step);
+            if (!cascade.cached || window.x != cascade.window.x || window.y != cascade.window.y || halfSize != cascade.halfSize)
+            {
+                cascade.cached = false;
+                staleCount++;
+            }
+            cascade.window = window;
+            cascade.halfSize = halfSize;
+            cascade.texel = texel;
+            cascade.projection = glm::ortho(window.x - halfSize, window.x + halfSize, window.y - halfSize, window.y + halfSize, depthNear, depthFar);
+            cascade.lightSpace = cascade.projection * lightView;
+            start = cascade.end;
+        }
+        return staleCount;
+    }
+
+    // the light's view and a cascade's projection, for drawing into it
+    const glm::mat4& view() const
+    {
+        return lightView;
+    }
+
+    const glm::mat4& projection(int cascade) const
+    {
+        return cascadeData[cascade].projection;
+    }
+
+    // what may cast into a cascade, for culling
+    Frustum frustum(int cascade) const
+    {
+        return Frustum(cascadeData[cascade].lightSpace);
+    }
+
+    bool cached(int cascade) const
+    {
+        return cascadeData[cascade].cached;
+    }
+
+    // draws that follow go into the cascade's static layer, cleared first;
+    // end() marks it as cached
+    void beginStatic(int cascade)
+    {
+        begin();
+        glBindFramebuffer(GL_FRAMEBUFFER, staticBuffers[cascade]);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        drawingStatic = cascade;
+    }
+
+    // draws that follow go into the cascade's live layer, which starts as a
+    // copy of the static one
+    void beginMoving(int cascade)
+    {
+        begin();
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, staticBuffers[cascade]);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, liveBuffers[cascade]);
+        glBlitFramebuffer(0, 0, size, size, 0, 0, size, size, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, liveBuffers[cascade]);
+    }
+
+    // back to the framebuffer and viewport of before begin*()
+    void end()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        if (drawingStatic >= 0)
+            cascadeData[drawingStatic].cached = true;
+        drawingStatic = -1;
+    }
+
+    // binds the live layers and sets where the cascades are; shader must be
+    // in use, on is false when nothing was drawn this frame
+    void setUniforms(const Shader& shader, bool on) const
+    {
+        shader.setBool("shadowsOn", on);
+        if (!on)
+            return;
+        activeTexture(GL_TEXTURE0 + unit);
+        bindTexture(GL_TEXTURE_2D_ARRAY, liveDepth);
+        activeTexture(GL_TEXTURE0);
+        for (int i = 0; i < cascades; i++)
+        {
+            shader.setMat4(lightSpaceNames[i], cascadeData[i].lightSpace);
+            shader.setFloat(endNames[i], cascadeData[i].end);
+            shader.setFloat(texelNames[i], cascadeData[i].texel);
+        }
+    }
+
+    int staleCascades() const
+    {
+        return staleCount;
+    }
+
+    // bytes of both layer sets
+    size_t bytes() const
+    {
+        return (size_t)2 * cascades * size * size * 4;
+    }
+
+private:
+    struct Cascade {
+        float end = 0.0f;           // view depth where the next cascade takes over
+        glm::vec2 window = glm::vec2(0.0f);
+        float halfSize = 0.0f;
+        float texel = 0.0f;         // world size of one texel
+        glm::mat4 projection;
+        glm::mat4 lightSpace;
+        bool cached = false;
+    };
+
+    GLuint staticDepth = 0;
+    GLuint liveDepth = 0;
+    GLuint staticBuffers[cascades] = {};
+    GLuint liveBuffers[cascades] = {};
+    Cascade cascadeData[cascades];
+    BoundingBox casters;
+    glm::vec3 lightDirection = glm::vec3(0.0f);
+    glm::mat4 lightView;
+    float depthNear = 0.0f;
+    float depthFar = 1.0f;
+    int staleCount = 0;
+    int drawingStatic = -1;
+    GLint target = 0;
+    GLint viewport[4] = {};
+
+    static constexpr const char* lightSpaceNames[cascades] = { "cascadeLightSpace[0]", "cascadeLightSpace[1]", "cascadeLightSpace[2]" };
+    static constexpr const char* endNames[cascades] = { "cascadeEnds[0]", "cascadeEnds[1]", "cascadeEnds[2]" };
+    static constexpr const char* texelNames[cascades] = { "cascadeTexels[0]", "cascadeTexels[1]", "cascadeTexels[2]" };
+
+    void begin()
+    {
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glViewport(0, 0, size, size);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        // slope scaled bias against acne on surfaces the light grazes
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(2.0f, 4.0f);
+    }
+
+    // one layer per cascade, each with a framebuffer of its own
+    static void allocate(GLuint texture, GLuint* buffers)
+    {
+        bindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, size, size, cascades, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        for (int i = 0; i < cascades; i++)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, buffers[i]);
+            glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texture, 0, i);
+            glDrawBuffer(GL_NONE);
+            glReadBuffer(GL_NONE);
+            if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+                std::cout << "Shadow cascade " << i << " is incomplete" << std::endl;
+        }
+    }
+};
+
+#endif /* cascaded_shadow_map_h */
@@ -0,0 +1,224 @@
+#ifndef cube_commands_h
+#define cube_commands_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include "shader.h"
+#include "gl_handle.h"
+#include "render_state.h"
+#include "transform_system.h"
+
+// Command buffer for the cubes of the objects that move, which the static
+// batch cannot bake. Between begin() and submit() every cube the object
+// helpers draw is only written down with its model matrix, material index and
+// texture; submit() puts the matrices and materials of the frame in one
+// instance buffer and draws them as instances of the unit cube, one
+// glDrawElementsInstanced per texture, however many cubes there are.
+//
+// The instance buffer holds three arrays one after the other: model matrices,
+// their normal matrices (computed four at a time, see computeNormalMatrices)
+// and material indices, so the vertex shader never inverts a matrix.
+//
+// GL 3.3 has neither glMultiDrawElementsIndirect nor gl_DrawID (or a base
+// instance), so the instance index takes the place of the draw ID: the per
+// cube data sits at attributes 7-10 (model), 13-15 (normal matrix) and 3
+// (material) with a divisor of 1, and each texture's run of the buffer is
+// reached by pointing those attributes at its first command.
+//
+// With sortFrontToBack() the cubes of a texture go out nearest to the viewer
+// first, by where their model matrix puts the cube's corner.
+class CubeCommands {
+public:
+    // cubeVBO/cubeEBO hold the cube the object helpers draw: 8 floats per
+    // vertex (position, normal, uv) and 36 indices
+    CubeCommands(GLuint cubeVBO, GLuint cubeEBO)
+    {
+        glGenVertexArrays(1, &commandVAO);
+        glGenBuffers(1, &instanceVBO);
+        bindVertexArray(commandVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        for (int column = 0; column < 4; column++)
+        {
+            glEnableVertexAttribArray(7 + column);
+            glVertexAttribDivisor(7 + column, 1);
+        }
+        for (int column = 0; column < 3; column++)
+        {
+            glEnableVertexAttribArray(13 + column);
+            glVertexAttribDivisor(13 + column, 1);
+        }
+        glEnableVertexAttribArray(3);
+        glVertexAttribDivisor(3, 1);
+        pointInstancesAt(0);
+        bindVertexArray(0);
+    }
+
+    ~CubeCommands()
+    {
+        deleteVertexArrays(1, &commandVAO);
+        glDeleteBuffers(1, &instanceVBO);
+    }
+
+    CubeCommands(const CubeCommands&) = delete;
+    CubeCommands& operator=(const CubeCommands&) = delete;
+
+    void begin()
+    {
+        commands.clear();
+        open = true;
+    }
+
+    // whether cubes are being written down instead of drawn
+    bool recording() const
+    {
+        return open;
+    }
+
+    // draws nearest to eye first from now on, or in the order added with
+    // NULL; eye is read at every add()
+    void sortFrontToBack(const glm::vec3* eye)
+    {
+        viewer = eye;
+    }
+
+    void add(const glm::mat4& model, int material, GLuint texture)
+    {
+        Command command;
+        command.model = model;
+        command.material = (float)material;
+        command.texture = texture;
+        command.distance = viewer != NULL ? glm::length(glm::vec3(model[3]) - *viewer) : 0.0f;
+        command.order = (unsigned int)commands.size();
+        commands.push_back(command);
+    }
+
+    // draws every cube added since begin() with shader, which must be current
+    void submit(Shader& shader)
+    {
+        open = false;
+        submittedCubes = (int)commands.size();
+        submittedDraws = 0;
+        if (commands.empty())
+            return;
+
+        // unsorted, cubes of one texture stay in the order they were added,
+        // so coplanar faces resolve the same way under GL_LESS (std::sort on
+        // the order as well, stable_sort would allocate every frame)
+        std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+            if (a.texture != b.texture)
+                return a.texture < b.texture;
+            return a.distance != b.distance ? a.distance < b.distance : a.order < b.order;
+        });
+        models.clear();
+        materials.clear();
+        for (const Command& command : commands)
+        {
+            models.push_back(command.model);
+            materials.push_back(command.material);
+        }
+        normals.resize(models.size());
+        computeNormalMatrices(models.data(), normals.data(), models.size());
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        size_t count = commands.size();
+        normalsOffset = count * sizeof(glm::mat4);
+        materialsOffset = normalsOffset + count * sizeof(NormalMatrix);
+        size_t bytes = materialsOffset + count * sizeof(float);
+        // fresh storage every frame, so the driver never waits for last
+        // frame's draws to finish reading the old one
+        if (bytes > capacity)
+            capacity = bytes * 2;
+        glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, normalsOffset, models.data());
+        glBufferSubData(GL_ARRAY_BUFFER, normalsOffset, materialsOffset - normalsOffset, normals.data());
+        glBufferSubData(GL_ARRAY_BUFFER, materialsOffset, bytes - materialsOffset, materials.data());
+
+        shader.setBool("useInstancing", true);
+        shader.setBool("useVertexMaterial", true);
+        shader.setMat4("model", glm::mat4(1.0f));
+        // the instance tint is not part of a command
+        glVertexAttrib4f(11, 1.0f, 1.0f, 1.0f, 1.0f);
+        // the cubes already told the draw listener about themselves when they
+        // were added, the runs must not count again
+        DrawListener* listener = RenderState::current().currentDrawListener();
+        RenderState::current().setDrawListener(NULL);
+        activeTexture(GL_TEXTURE0);
+        bindVertexArray(commandVAO);
+        size_t first = 0;
+        while (first < commands.size())
+        {
+            size_t end = first + 1;
+            while (end < commands.size() && commands[end].texture == commands[first].texture)
+                end++;
+            bindTexture(GL_TEXTURE_2D, commands[first].texture);
+            pointInstancesAt(first);
+            drawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, (GLsizei)(end - first));
+            submittedDraws++;
+            first = end;
+        }
+        bindVertexArray(0);
+        RenderState::current().setDrawListener(listener);
+        shader.setBool("useInstancing", false);
+        shader.setBool("useVertexMaterial", false);
+    }
+
+    // last submit(): cubes drawn and the draw calls they took
+    int cubeCount() const
+    {
+        return submittedCubes;
+    }
+
+    int drawCount() const
+    {
+        return submittedDraws;
+    }
+
+private:
+    struct Command {
+        glm::mat4 model;
+        float material;
+        GLuint texture;
+        float distance;     // from the viewer, 0 unsorted
+        unsigned int order;
+    };
+
+    std::vector<Command> commands;
+    // reused every frame so recording does not allocate
+    std::vector<glm::mat4> models;
+    std::vector<NormalMatrix> normals;
+    std::vector<float> materials;
+    bool open = false;
+    const glm::vec3* viewer = NULL;
+    size_t capacity = 0;
+    size_t normalsOffset = 0;
+    size_t materialsOffset = 0;
+    int submittedCubes = 0;
+    int submittedDraws = 0;
+    GLHandle commandVAO;
+    GLHandle instanceVBO;
+
+    // instance attributes start at command first, the VAO and instanceVBO
+    // have to be bound
+    void pointInstancesAt(size_t first)
+    {
+        const char* model = (const char*)(first * sizeof(glm::mat4));
+        for (int column = 0; column < 4; column++)
+            glVertexAttribPointer(7 + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), model + column * sizeof(glm::vec4));
+        const char* normal = (const char*)(normalsOffset + first * sizeof(NormalMatrix));
+        for (int column = 0; column < 3; column++)
+            glVertexAttribPointer(13 + column, 3, GL_FLOAT, GL_FALSE, sizeof(NormalMatrix), normal + column * sizeof(glm::vec4));
+        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(float), (const char*)(materialsOffset + first * sizeof(float)));
+    }
+};
+
+#endif /* cube_commands_h */
@@ -14,6 +14,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "gl_handle.h"
 
 using namespace std;
 
@@ -46,11 +47,17 @@ public:
     }
     ~Curve()
     {
-        glDeleteVertexArrays(1, &fishVAO);
-        glDeleteVertexArrays(1, &bezierVAO);
+        deleteVertexArrays(1, &bezierVAO);
         glDeleteBuffers(1, &bezierVBO);
         glDeleteBuffers(1, &bezierEBO);
     }
+
+    // owns its GL buffers: move it, never copy it
+    Curve(Curve&&) = default;
+    Curve& operator=(Curve&&) = default;
+    Curve(const Curve&) = delete;
+    Curve& operator=(const Curve&) = delete;
+
     void draw(Shader& lightingShader, glm::mat4 model, glm::vec3 amb)
     {
         lightingShader.use();
@@ -64,24 +71,24 @@ public:
         lightingShader.setInt("material.diffuseMap", 0);  // 0 corresponds to GL_TEXTURE0
         lightingShader.setInt("material.specularMap", 1); // 1 corresponds to GL_TEXTURE1
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, diffuseMap);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, diffuseMap);
 
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, specularMap);
+        activeTexture(GL_TEXTURE1);
+        bindTexture(GL_TEXTURE_2D, specularMap);
 
-        glBindVertexArray(fishVAO);
-        glDrawElements(GL_TRIANGLE_FAN, (unsigned int)indices.size(), GL_UNSIGNED_INT, (void*)0);
+        bindVertexArray(fishVAO);
+        drawElements(GL_TRIANGLE_FAN, (unsigned int)indices.size(), GL_UNSIGNED_INT, (void*)0);
 
         // unbind VAO
-        glBindVertexArray(0);
+        bindVertexArray(0);
     }
 
 private:
-    unsigned int fishVAO;
-    unsigned int bezierVAO;
-    unsigned int bezierVBO;
-    unsigned int bezierEBO;
+    unsigned int fishVAO;   // same VAO as bezierVAO, hollowBezier() returns it
+    GLHandle bezierVAO;
+    GLHandle bezierVBO;
+    GLHandle bezierEBO;
 
 
     unsigned int drawControlPoints()
@@ -92,7 +99,7 @@ private:
         glGenVertexArrays(1, &controlPointVAO);
         glGenBuffers(1, &controlPointVBO);
 
-        glBindVertexArray(controlPointVAO);
+        bindVertexArray(controlPointVAO);
 
         glBindBuffer(GL_ARRAY_BUFFER, controlPointVBO);
         glBufferData(GL_ARRAY_BUFFER, (unsigned int)cntrlPoints.size() * sizeof(float), cntrlPoints.data(), GL_STATIC_DRAW);
@@ -238,7 +245,7 @@ private:
         }
 
         glGenVertexArrays(1, &bezierVAO);
-        glBindVertexArray(bezierVAO);
+        bindVertexArray(bezierVAO);
 
         // create VBO to copy vertex data to VBO
         glGenBuffers(1, &bezierVBO);
@@ -267,7 +274,7 @@ private:
         glVertexAttribPointer(2, 2, GL_FLOAT, false, stride, (void*)(sizeof(float) * 6)); // Add this line for texture coordinates
 //
         // unbind VAO, VBO and EBO
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -7,6 +7,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "primitive_mesh.h"
 #define PI 3.141516
 
 class CurvedPipeSegment {
@@ -34,14 +35,8 @@ public:
         this->specular = spec;
         this->shininess = shiny;
 
-        generateSegmentVerticesAndIndices(pipeRadius, arcLength);
-        setupSegmentVAO();
-    }
-
-    ~CurvedPipeSegment() {
-        glDeleteVertexArrays(1, &segmentVAO);
-        glDeleteBuffers(1, &segmentVBO);
-        glDeleteBuffers(1, &segmentEBO);
+        PrimitiveKey key = { PrimitiveKey::PIPE_SEGMENT, 36, 12, pipeRadius, arcLength };
+        mesh = PrimitiveMeshRegistry::shared().acquire(key, generateSegmentVerticesAndIndices);
     }
 
     void draw(Shader& shader, glm::mat4 model = glm::mat4(1.0f)) {
@@ -52,14 +47,13 @@ public:
         shader.setVec3("material.specular", this->specular);
         shader.setFloat("material.shininess", this->shininess);
 
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
 
         transform = positionMatrix * rotationMatrix * scaleMatrix;
         model = model * transform;
         shader.setMat4("model", model);
 
-        glBindVertexArray(segmentVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
     }
 
     void setPosition(glm::vec3 pos) {
@@ -74,14 +68,20 @@ public:
         rotationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), axis);
     }
 
+    // world box of what draw(shader, model) covers
+    BoundingBox bounds(glm::mat4 model = glm::mat4(1.0f)) const
+    {
+        return mesh.bounds.transformed(model * positionMatrix * rotationMatrix * scaleMatrix);
+    }
+
 private:
-    unsigned int segmentVAO, segmentVBO, segmentEBO;
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
+    PrimitiveMesh mesh;
 
-    void generateSegmentVerticesAndIndices(float pipeRadius, float arcLength) {
-        const int tubeSegments = 36;
-        const int arcSegments = 12; // Segments along the curve
+    static void generateSegmentVerticesAndIndices(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices) {
+        const float pipeRadius = key.radius;
+        const float arcLength = key.arcLength;
+        const int tubeSegments = key.sectors;
+        const int arcSegments = key.stacks; // Segments along the curve
         float tubeStep = 2 * PI / tubeSegments;
         float arcStep = arcLength / arcSegments;
 
@@ -127,31 +127,6 @@ private:
             }
         }
     }
-
-    void setupSegmentVAO() {
-        glGenVertexArrays(1, &segmentVAO);
-        glGenBuffers(1, &segmentVBO);
-        glGenBuffers(1, &segmentEBO);
-
-        glBindVertexArray(segmentVAO);
-
-        glBindBuffer(GL_ARRAY_BUFFER, segmentVBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, segmentEBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-        glEnableVertexAttribArray(2);
-
-        glBindVertexArray(0);
-    }
 };
 
 #endif /* CURVED_PIPE_SEGMENT_H */
@@ -7,6 +7,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "primitive_mesh.h"
 #define PI 3.141516
 
 class Cylinder {
@@ -39,16 +40,9 @@ public:
         this->specular = spec;
         this->shininess = shiny;
 
-        generateCylinderVerticesAndIndices();
-        setupCylinderVAO();
-    }
-
-    // Destructor
-    ~Cylinder()
-    {
-        glDeleteVertexArrays(1, &cylinderVAO);
-        glDeleteBuffers(1, &cylinderVBO);
-        glDeleteBuffers(1, &cylinderEBO);
+        // every cylinder has the same shape, they all share one mesh
+        PrimitiveKey key = { PrimitiveKey::CYLINDER, 36, 1, 1.0f, 0.0f };
+        mesh = PrimitiveMeshRegistry::shared().acquire(key, generateCylinderVerticesAndIndices);
     }
 
     void draw(Shader& shader, glm::mat4 model = glm::mat4(1.0f))
@@ -63,14 +57,13 @@ public:
 
         // Bind diffuse map
         //glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
 
         transform = positionMatrix * rotationMatrix * scaleMatrix;
         model = model * transform;
         shader.setMat4("model", model);
 
-        glBindVertexArray(cylinderVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
     }
 
     // Transformation setters
@@ -86,18 +79,19 @@ public:
         rotationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), axis);
     }
 
-private:
-    unsigned int cylinderVAO;
-    unsigned int cylinderVBO;
-    unsigned int cylinderEBO;
+    // world box of what draw(shader, model) covers
+    BoundingBox bounds(glm::mat4 model = glm::mat4(1.0f)) const
+    {
+        return mesh.bounds.transformed(model * positionMatrix * rotationMatrix * scaleMatrix);
+    }
 
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
+private:
+    PrimitiveMesh mesh;
 
-    void generateCylinderVerticesAndIndices() {
-        const int sectors = 36;       // Number of sectors (horizontal divisions)
+    static void generateCylinderVerticesAndIndices(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices) {
+        const int sectors = key.sectors;       // Number of sectors (horizontal divisions)
         const float height = 2.0f;    // Height of the cylinder
-        const float radius = 1.0f;    // Radius of the cylinder
+        const float radius = key.radius;    // Radius of the cylinder
 
         float sectorStep = 2 * PI / sectors;
 
@@ -149,36 +143,6 @@ private:
             indices.push_back(top2);
         }
     }
-
-
-
-    void setupCylinderVAO() {
-        glGenVertexArrays(1, &cylinderVAO);
-        glGenBuffers(1, &cylinderVBO);
-        glGenBuffers(1, &cylinderEBO);
-
-        glBindVertexArray(cylinderVAO);
-
-        glBindBuffer(GL_ARRAY_BUFFER, cylinderVBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cylinderEBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        // Position attribute
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-
-        // Normal attribute
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-
-        // Texture coordinate attribute
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-        glEnableVertexAttribArray(2);
-
-        glBindVertexArray(0);
-    }
 };
 
 #endif /* CYLINDER_H */
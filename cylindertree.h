@@ -40,7 +40,7 @@ public:
         buildVertices();
 
         glGenVertexArrays(1, &cylinderVAO);
-        glBindVertexArray(cylinderVAO);
+        bindVertexArray(cylinderVAO);
 
         // Create VBO for vertex data
         unsigned int cylinderVBO;
@@ -72,7 +72,7 @@ public:
         glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 6));      // Texture
 
         // Unbind VAO and buffers
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
@@ -115,12 +115,12 @@ public:
 
         lightingShader.setMat4("model", model);
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, texture);
 
-        glBindVertexArray(cylinderVAO);
-        glDrawElements(GL_TRIANGLES, this->getIndexCount(), GL_UNSIGNED_INT, (void*)0);
-        glBindVertexArray(0);
+        bindVertexArray(cylinderVAO);
+        drawElements(GL_TRIANGLES, this->getIndexCount(), GL_UNSIGNED_INT, (void*)0);
+        bindVertexArray(0);
     }
 
 private:
@@ -285,7 +285,7 @@ public:
         buildVertices();
 
         glGenVertexArrays(1, &cylinderVAO);
-        glBindVertexArray(cylinderVAO);
+        bindVertexArray(cylinderVAO);
 
         // Create VBO for vertex data
         unsigned int cylinderVBO;
@@ -315,7 +315,7 @@ public:
         glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(sizeof(float) * 3));      // Normal
 
         // Unbind VAO and buffers
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
@@ -358,9 +358,9 @@ public:
 
         lightingShader.setMat4("model", model);
 
-        glBindVertexArray(cylinderVAO);
-        glDrawElements(GL_TRIANGLES, this->getIndexCount(), GL_UNSIGNED_INT, (void*)0);
-        glBindVertexArray(0);
+        bindVertexArray(cylinderVAO);
+        drawElements(GL_TRIANGLES, this->getIndexCount(), GL_UNSIGNED_INT, (void*)0);
+        bindVertexArray(0);
     }
 
 private:
@@ -0,0 +1,57 @@
+#version 330 core
+// Lighting pass of deferred shading (deferred_renderer.h): lights each pixel
+// of the G-buffer once, with the lights, materials and light functions of
+// lighting.glsl that fragmentShader.fs draws with too
+
+out vec4 FragColor;
+
+#include "lighting.glsl"
+
+uniform bool lightingOn;
+
+//what the G-buffer pass of fragmentShader.fs wrote, read at this pixel
+uniform sampler2D gAlbedo;
+uniform sampler2D gPosition;
+uniform sampler2D gNormal;
+uniform sampler2D gMaterial;
+uniform sampler2D gDepth;
+
+void main()
+{
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    //nothing was drawn here, the clear color stays
+    float depth = texelFetch(gDepth, pixel, 0).r;
+    if(depth == 1.0f)
+    {
+        discard;
+    }
+    gl_FragDepth = depth;
+
+    vec4 texel = texelFetch(gAlbedo, pixel, 0);
+    vec4 stored = texelFetch(gPosition, pixel, 0);
+    vec3 FragPos = stored.xyz;
+    vec3 Normal = texelFetch(gNormal, pixel, 0).xyz;
+    vec4 material = texelFetch(gMaterial, pixel, 0);
+    Material surface = materials[int(material.w + 0.5f)];
+    surface.ambient.rgb *= material.rgb;
+    surface.diffuse.rgb *= material.rgb;
+
+    //Directional Light Calculation
+    vec4 dirL = CalcDirLight(surface, directionalLight, Normal, FragPos, CalcShadow(Normal, FragPos, stored.w));
+
+
+    //Point and Spot Lights of this pixel's cluster only
+    vec4 localL = CalcClusterLights(surface, Normal, FragPos, stored.w);
+
+
+    //Aggregate all result
+
+    vec4 result = dirL + localL;
+
+    if(!lightingOn)
+    {
+        result = surface.ambient;
+    }
+
+    FragColor = texel * result ;
+}
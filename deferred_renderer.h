@@ -0,0 +1,160 @@
+#ifndef deferred_renderer_h
+#define deferred_renderer_h
+
+#include <glad/glad.h>
+#include <iostream>
+#include "shader.h"
+#include "gl_handle.h"
+#include "render_state.h"
+
+// Deferred shading, the alternative to lighting every fragment in
+// fragmentShader.fs as it is drawn. Between beginGeometry() and light() the
+// scene draws into a G-buffer instead of the screen, with ourShader's
+// gBufferPass set: fragmentShader.fs then only writes what lighting needs,
+//
+//     0  albedo     RGBA8    the texel
+//     1  position   RGBA32F  world position, view depth
+//     2  normal     RGBA16F  world normal
+//     3  material   RGBA16F  instance tint, material index
+//
+// and light() shades every covered pixel once with deferredFragmentShader.fs,
+// which looks up the directional light, the material table and the light
+// clusters of the pixel's screen tile the same way the forward shader does.
+// Fragments hidden behind others are only written, never lit, so the cost of
+// lighting follows the pixels on screen rather than the faces drawn.
+//
+// light() also copies the G-buffer's depth into the target framebuffer, so
+// what is drawn forward afterwards (the light cubes, the unlit shapes) is
+// still hidden behind the scene.
+class DeferredRenderer {
+public:
+    static const int targets = 4;
+    // G-buffer samplers go after the cluster buffers (light_clusters.h)
+    static const int firstUnit = 5;
+
+    DeferredRenderer()
+    {
+        glGenFramebuffers(1, &gBuffer);
+        glGenTextures(targets, textures);
+        glGenTextures(1, &depthTexture);
+        // the lighting pass draws one triangle over the screen from gl_VertexID,
+        // but a core context still wants a VAO bound
+        glGenVertexArrays(1, &screenVAO);
+    }
+
+    ~DeferredRenderer()
+    {
+        glDeleteFramebuffers(1, &gBuffer);
+        deleteTextures(targets, textures);
+        deleteTextures(1, &depthTexture);
+        deleteVertexArrays(1, &screenVAO);
+    }
+
+    DeferredRenderer(const DeferredRenderer&) = delete;
+    DeferredRenderer& operator=(const DeferredRenderer&) = delete;
+
+    // points the lighting shader's samplers at the G-buffer; shader must be in use
+    void attach(const Shader& shader) const
+    {
+        shader.setInt("gAlbedo", firstUnit);
+        shader.setInt("gPosition", firstUnit + 1);
+        shader.setInt("gNormal", firstUnit + 2);
+        shader.setInt("gMaterial", firstUnit + 3);
+        shader.setInt("gDepth", firstUnit + 4);
+    }
+
+    // draws that follow go into the G-buffer, resized to width x height first
+    // if it has to be; false if the driver cannot draw into it, the frame
+    // is then shaded forward
+    bool beginGeometry(int width, int height)
+    {
+        if (width != this->width || height != this->height)
+            resize(width, height);
+        if (!complete)
+            return false;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+        // pixels no draw covers keep depth 1 and are skipped by light(), so
+        // the color targets never need clearing
+        glClear(GL_DEPTH_BUFFER_BIT);
+        return true;
+    }
+
+    // shades the G-buffer into the framebuffer that was bound at
+    // beginGeometry(); the lighting shader must be in use
+    void light()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        for (int i = 0; i < targets; i++)
+        {
+            activeTexture(GL_TEXTURE0 + firstUnit + i);
+            bindTexture(GL_TEXTURE_2D, textures[i]);
+        }
+        activeTexture(GL_TEXTURE0 + firstUnit + targets);
+        bindTexture(GL_TEXTURE_2D, depthTexture);
+        activeTexture(GL_TEXTURE0);
+
+        // the pass writes every pixel's depth from gDepth, GL_LESS against the
+        // cleared target lets them all through
+        bindVertexArray(screenVAO);
+        drawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    // bytes of the G-buffer and its depth
+    size_t bytes() const
+    {
+        return (size_t)width * height * (4 + 16 + 8 + 8 + 4);
+    }
+
+private:
+    GLuint gBuffer = 0;
+    GLuint textures[targets] = {};
+    GLuint depthTexture = 0;
+    GLHandle screenVAO;
+    GLint target = 0;
+    int width = 0;
+    int height = 0;
+    bool complete = false;
+
+    void resize(int width, int height)
+    {
+        this->width = width;
+        this->height = height;
+        const GLenum formats[targets] = { GL_RGBA8, GL_RGBA32F, GL_RGBA16F, GL_RGBA16F };
+        const GLenum types[targets] = { GL_UNSIGNED_BYTE, GL_FLOAT, GL_FLOAT, GL_FLOAT };
+        const GLenum drawBuffers[targets] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
+        GLint previous = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+        glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+        activeTexture(GL_TEXTURE0 + firstUnit);
+        for (int i = 0; i < targets; i++)
+        {
+            bindTexture(GL_TEXTURE_2D, textures[i]);
+            glTexImage2D(GL_TEXTURE_2D, 0, formats[i], width, height, 0, GL_RGBA, types[i], NULL);
+            setNearest();
+            glFramebufferTexture2D(GL_FRAMEBUFFER, drawBuffers[i], GL_TEXTURE_2D, textures[i], 0);
+        }
+        bindTexture(GL_TEXTURE_2D, depthTexture);
+        // stencil for the depth pre-pass, sampling still reads depth
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, width, height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, NULL);
+        setNearest();
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0);
+        activeTexture(GL_TEXTURE0);
+        glDrawBuffers(targets, drawBuffers);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete)
+            std::cout << "G-buffer of " << width << "x" << height << " is incomplete, shading forward" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    }
+
+    // every pixel is read at its own coordinates, never filtered
+    static void setNearest()
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+};
+
+#endif /* deferred_renderer_h */
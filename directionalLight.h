@@ -5,6 +5,14 @@
 #include <glm/glm.hpp>
 #include "shader.h"
 
+// std140 image of the DirectionalLight struct in the Lights block of fragmentShader.fs
+struct DirectionalLightBlock {
+    glm::vec4 direction;
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+};
+
 class DirectionalLight {
 public:
     glm::vec3 direction;
@@ -24,13 +32,12 @@ public:
         lightNumber = num;
     }
 
-    void setUpLight(Shader& lightingShader)
+    void setUpLight(DirectionalLightBlock& block) const
     {
-        lightingShader.use();
-        lightingShader.setVec4("directionalLight.ambient", ambient * ambientOn * isOn);
-        lightingShader.setVec4("directionalLight.diffuse", diffuse * diffuseOn * isOn);
-        lightingShader.setVec4("directionalLight.specular", specular * specularOn * isOn);
-        lightingShader.setVec3("directionalLight.direction", direction);
+        block.ambient = ambient * ambientOn * isOn;
+        block.diffuse = diffuse * diffuseOn * isOn;
+        block.specular = specular * specularOn * isOn;
+        block.direction = glm::vec4(direction, 0.0f);
     }
 
     void turnOff()
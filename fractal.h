@@ -3,7 +3,8 @@
 
 #include <glm/glm.hpp>
 #include <vector>
-#include "Shader.h"
+#include "shader.h"
+#include "gl_handle.h"
 
 class FractalTree {
 public:
@@ -23,7 +24,7 @@ public:
 
         // Generate VAO and VBO for rendering
         glGenVertexArrays(1, &treeVAO);
-        glBindVertexArray(treeVAO);
+        bindVertexArray(treeVAO);
 
         glGenBuffers(1, &treeVBO);
         glBindBuffer(GL_ARRAY_BUFFER, treeVBO);
@@ -34,15 +35,21 @@ public:
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
 
         // Unbind VAO and VBO
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     ~FractalTree() {
-        glDeleteVertexArrays(1, &treeVAO);
+        deleteVertexArrays(1, &treeVAO);
         glDeleteBuffers(1, &treeVBO);
     }
 
+    // owns its GL buffers: move it, never copy it
+    FractalTree(FractalTree&&) = default;
+    FractalTree& operator=(FractalTree&&) = default;
+    FractalTree(const FractalTree&) = delete;
+    FractalTree& operator=(const FractalTree&) = delete;
+
     void drawTree(Shader& shader, glm::mat4 model) const {
         shader.use();
         shader.setVec3("color", branchColor);
@@ -51,16 +58,16 @@ public:
         // Set line width for branches
         glLineWidth(branchWidth);
 
-        glBindVertexArray(treeVAO);
-        glDrawArrays(GL_LINES, 0, vertices.size() / 3);
-        glBindVertexArray(0);
+        bindVertexArray(treeVAO);
+        drawArrays(GL_LINES, 0, vertices.size() / 3);
+        bindVertexArray(0);
 
         // Reset line width to default for other drawings
         glLineWidth(1.0f);
     }
 
 private:
-    unsigned int treeVAO, treeVBO;
+    GLHandle treeVAO, treeVBO;
     float branchLength;    // Length of the branches
     float branchAngle;     // Angle between branches
     int recursionDepth;    // Maximum depth of recursion
@@ -1,172 +1,96 @@
 #version 330 core
 
-out vec4 FragColor;
+layout (location = 0) out vec4 FragColor;
+//the rest of the G-buffer, only written with gBufferPass (deferred_renderer.h)
+layout (location = 1) out vec4 GPosition;
+layout (location = 2) out vec4 GNormal;
+layout (location = 3) out vec4 GMaterial;
 
-struct Material {
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-    float shininess;
-};
+#include "lighting.glsl"
 
-struct PointLight {              //Point Light
-    vec3 position;
-
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-
-    float Kc;
-    float Kl;
-    float Kq;
-
-};
-
-struct DirectionalLight {              //Directional Light
-    vec3 direction;
-
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-};
-
-struct SpotLight {                    //Spot Light
-    vec3 position;
-    vec3 direction;
-    float cutOff;
-    float outerCutOff;
-
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 specular;
-
-    float Kc;
-    float Kl;
-    float Kq;
-};
-
-uniform PointLight pointLight;
-uniform DirectionalLight directionalLight;
-uniform SpotLight spotLight;
-
-
-uniform Material material;
+uniform int materialIndex;
+uniform bool useVertexMaterial;
 uniform vec4 objectColor;
 uniform vec4 lightColor;
 uniform vec3 lightPos;
-uniform vec3 viewPos;
-
 uniform bool lightingOn;
 uniform sampler2D ourTexture;
+//the static batch's textures packed into layers (texture_array.h), on unit 1
+uniform sampler2DArray ourTextureArray;
+uniform bool useTextureArray;
 uniform bool dark;
+//deferred shading: write the surface to the G-buffer, deferredFragmentShader.fs lights it
+uniform bool gBufferPass;
+//depth pre-pass: only depth is written, the fragment needs no color
+uniform bool depthOnly;
+//overdraw view: every fragment adds one to its pixel (overdraw_view.h)
+uniform bool overdrawPass;
 
 in vec3 Normal;
 in vec3 FragPos;
 in vec2 TexCoord;
-
-//Functions prototypes
-vec4 CalcDirLight(Material material, DirectionalLight light, vec3 normal, vec3 fragPos);
-vec4 CalcPointLight(Material material, PointLight light, vec3 normal, vec3 fragPos);
-vec4 CalcSpotLight(Material material, SpotLight light, vec3 normal, vec3 fragPos);
-
+flat in float VertexMaterial;
+flat in vec4 InstanceTint;
+flat in float Layer;
+in float ViewDepth;
 
 void main()
 {
+    if(depthOnly)
+    {
+        return;
+    }
+    if(overdrawPass)
+    {
+        FragColor = vec4(1.0f);
+        return;
+    }
 
-    //Directional Light Calculation
-    vec4 dirL = CalcDirLight(material, directionalLight, Normal, FragPos);
+    //Static batch carries its material index per vertex
+    int index = materialIndex;
+    if(useVertexMaterial)
+    {
+        index = int(VertexMaterial);
+    }
+    vec4 texel = texture(ourTexture, TexCoord);
+    if(useTextureArray)
+    {
+        texel = texture(ourTextureArray, vec3(TexCoord, Layer));
+    }
+
+    if(gBufferPass)
+    {
+        FragColor = texel;
+        GPosition = vec4(FragPos, ViewDepth);
+        GNormal = vec4(normalize(Normal), 0.0f);
+        GMaterial = vec4(InstanceTint.rgb, float(index));
+        return;
+    }
 
+    Material surface = materials[index];
+    surface.ambient *= InstanceTint;
+    surface.diffuse *= InstanceTint;
 
-    //Point Light
-    vec4 pointL = CalcPointLight(material, pointLight, Normal, FragPos);
+    //Directional Light Calculation
+    vec4 dirL = CalcDirLight(surface, directionalLight, Normal, FragPos, CalcShadow(Normal, FragPos, ViewDepth));
 
 
-    //Spot Light
-    vec4 spotL = CalcSpotLight(material, spotLight, Normal, FragPos);
+    //Point and Spot Lights of this fragment's cluster only
+    vec4 localL = CalcClusterLights(surface, Normal, FragPos, ViewDepth);
 
 
     //Aggregate all result
 
-    vec4 result = dirL + pointL + spotL;
+    vec4 result = dirL + localL;
 
     if(!lightingOn)
     {
-        result = material.ambient;
+        result = surface.ambient;
     }
     if(dark)
     {
         result = vec4(0.0f);
     }
 
-    FragColor = texture(ourTexture, TexCoord) * result ;
+    FragColor = texel * result ;
 }
-
-vec4 CalcDirLight(Material material, DirectionalLight light, vec3 normal, vec3 fragPos)
-{
-    vec4 ambient = light.ambient * material.ambient;
-    vec3 norm = normalize(normal);
-
-    vec3 lightDir = normalize(-light.direction);
-    float diff = max(dot(norm, lightDir), 0.0);
-    vec4 diffuse = light.diffuse * (diff * material.diffuse);
-
-    vec3 viewDir = normalize(viewPos - fragPos);
-    vec3 reflectDir = reflect(-lightDir, norm);
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
-    vec4 specular = light.specular * (spec * material.specular);
-
-    return (ambient + diffuse + specular);
-}
-
-vec4 CalcPointLight(Material material, PointLight light, vec3 normal, vec3 fragPos)
-{
-    float distance = length(light.position - fragPos);
-    float attenuation = 1.0 / (light.Kc + light.Kl * distance + light.Kq * (distance * distance));
-
-    vec4 ambient = light.ambient * material.ambient;
-    ambient *= attenuation;
-
-    vec3 norm = normalize(normal);
-    vec3 lightDir = normalize(light.position - fragPos);
-    float diff = max(dot(norm, lightDir), 0.0);
-    vec4 diffuse = light.diffuse * (diff * material.diffuse);
-    diffuse *= attenuation;
-
-    vec3 viewDir = normalize(viewPos - fragPos);
-    vec3 reflectDir = reflect(-lightDir, norm);
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
-    vec4 specular = light.specular * (spec * material.specular);
-    specular *= attenuation;
-
-    return (ambient + diffuse + specular );
-}
-
-vec4 CalcSpotLight(Material material, SpotLight light, vec3 normal, vec3 fragPos)
-{
-    float distance = length(light.position - fragPos);
-    float attenuation = 1.0 / (light.Kc + light.Kl * distance + light.Kq * (distance * distance));
-
-    vec4 ambient = light.ambient * material.ambient;
-    ambient *= attenuation;
-
-    vec3 norm = normalize(normal);
-    vec3 lightDir = normalize(light.position - fragPos);
-    float diff = max(dot(norm, lightDir), 0.0);
-    vec4 diffuse = light.diffuse * (diff * material.diffuse);
-    diffuse *= attenuation;
-
-    vec3 viewDir = normalize(viewPos - fragPos);
-    vec3 reflectDir = reflect(-lightDir, norm);
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
-    vec4 specular = light.specular * (spec * material.specular);
-    specular *= attenuation;
-
-    float theta = dot(lightDir, normalize(-light.direction));
-    float epsilon = light.cutOff - light.outerCutOff;
-    float intensity = clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
-    ambient *= intensity;
-    diffuse *= intensity;
-    specular *= intensity;
-
-    return (ambient + diffuse + specular);
-}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef frustum_h
+#define frustum_h
+
+#include <glm/glm.hpp>
+#include <cfloat>
+
+// Axis aligned box in whatever space its corners were added in. A default
+// constructed box is empty and expanding it by anything gives that thing.
+struct BoundingBox {
+    glm::vec3 min = glm::vec3(FLT_MAX);
+    glm::vec3 max = glm::vec3(-FLT_MAX);
+
+    bool empty() const
+    {
+        return min.x > max.x;
+    }
+
+    void expand(const glm::vec3& point)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    void expand(const BoundingBox& box)
+    {
+        if (box.empty())
+            return;
+        expand(box.min);
+        expand(box.max);
+    }
+
+    // how far point is from the box, 0 inside it
+    float distanceTo(const glm::vec3& point) const
+    {
+        glm::vec3 outside = glm::max(glm::max(min - point, point - max), glm::vec3(0.0f));
+        return glm::length(outside);
+    }
+
+    // box around this one after transform, without visiting the eight corners:
+    // the centre moves with the matrix, the half size with its absolute value
+    BoundingBox transformed(const glm::mat4& transform) const
+    {
+        if (empty())
+            return *this;
+        glm::vec3 center = glm::vec3(transform * glm::vec4((min + max) * 0.5f, 1.0f));
+        glm::mat3 linear = glm::mat3(transform);
+        glm::vec3 halfSize = (max - min) * 0.5f;
+        glm::vec3 extent = glm::abs(linear[0]) * halfSize.x + glm::abs(linear[1]) * halfSize.y + glm::abs(linear[2]) * halfSize.z;
+
+        BoundingBox box;
+        box.min = center - extent;
+        box.max = center + extent;
+        return box;
+    }
+};
+
+// The six planes of a projection * view matrix, pointing inwards. A box is
+// culled only when it lies entirely behind one plane, so the test never hides
+// something visible but may keep a box that is near a frustum corner.
+class Frustum {
+public:
+    Frustum() {}
+
+    explicit Frustum(const glm::mat4& viewProjection)
+    {
+        // rows of the matrix, glm stores columns
+        glm::vec4 row[4];
+        for (int i = 0; i < 4; i++)
+            row[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+
+        planes[0] = row[3] + row[0];    // left
+        planes[1] = row[3] - row[0];    // right
+        planes[2] = row[3] + row[1];    // bottom
+        planes[3] = row[3] - row[1];    // top
+        planes[4] = row[3] + row[2];    // near
+        planes[5] = row[3] - row[2];    // far
+        for (int i = 0; i < 6; i++)
+            planes[i] *= 1.0f / glm::length(glm::vec3(planes[i]));
+    }
+
+    bool intersects(const BoundingBox& box) const
+    {
+        if (box.empty())
+            return false;
+        for (int i = 0; i < 6; i++)
+        {
+            // the corner furthest along the plane normal
+            glm::vec3 corner = glm::vec3(planes[i].x > 0.0f ? box.max.x : box.min.x,
+                planes[i].y > 0.0f ? box.max.y : box.min.y,
+                planes[i].z > 0.0f ? box.max.z : box.min.z);
+            if (glm::dot(glm::vec3(planes[i]), corner) + planes[i].w < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    bool intersects(const glm::vec3& center, float radius) const
+    {
+        for (int i = 0; i < 6; i++)
+            if (glm::dot(glm::vec3(planes[i]), center) + planes[i].w < -radius)
+                return false;
+        return true;
+    }
+
+private:
+    glm::vec4 planes[6];
+};
+
+// bounding volumes tested against the view this frame and how many of them
+// were skipped, shown in the window title
+struct CullCounters {
+    int tested = 0;
+    int culled = 0;
+};
+
+#endif /* frustum_h */
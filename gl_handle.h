@@ -0,0 +1,52 @@
+#ifndef gl_handle_h
+#define gl_handle_h
+
+#include <glad/glad.h>
+
+// Name of a VAO/VBO/EBO owned by a mesh class. It can be moved but never
+// copied, and a moved-from handle is 0, which glDelete* ignores. A mesh
+// holding these can therefore only be moved, and its destructor no longer
+// deletes buffers that a copy is still drawing with.
+//
+// &handle still yields a GLuint* so glGen*(1, &handle) works unchanged.
+class GLHandle {
+public:
+    GLHandle() : name(0) {}
+
+    GLHandle(GLHandle&& other) noexcept : name(other.name)
+    {
+        other.name = 0;
+    }
+
+    GLHandle& operator=(GLHandle&& other) noexcept
+    {
+        // the old name goes to other, whose owner deletes it
+        GLuint old = name;
+        name = other.name;
+        other.name = old;
+        return *this;
+    }
+
+    GLHandle(const GLHandle&) = delete;
+    GLHandle& operator=(const GLHandle&) = delete;
+
+    operator GLuint() const
+    {
+        return name;
+    }
+
+    GLuint* operator&()
+    {
+        return &name;
+    }
+
+    const GLuint* operator&() const
+    {
+        return &name;
+    }
+
+private:
+    GLuint name;
+};
+
+#endif /* gl_handle_h */
@@ -7,6 +7,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "primitive_mesh.h"
 
 using namespace std;
 
@@ -38,14 +39,8 @@ public:
         this->specular = spec;
         this->shininess = shiny;
 
-        setUpHalfSphereVertexDataAndConfigureVertexAttribute();
-    }
-
-    // Destructor
-    ~HalfSphere() {
-        glDeleteVertexArrays(1, &halfSphereVAO);
-        glDeleteBuffers(1, &halfSphereVBO);
-        glDeleteBuffers(1, &halfSphereEBO);
+        PrimitiveKey key = { PrimitiveKey::HALF_SPHERE, 36, 18, 1.0f, 0.0f };
+        mesh = PrimitiveMeshRegistry::shared().acquire(key, generateHalfSphereVerticesAndIndices);
     }
 
     void draw(Shader& shader, glm::mat4 model = glm::mat4(1.0f)) {
@@ -58,14 +53,13 @@ public:
         shader.setFloat("material.shininess", this->shininess);
 
         // Bind texture
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
         transform = positionMatrix * rotationMatrix * scaleMatrix;
         model = model * transform;
         shader.setMat4("model", model);
 
-        glBindVertexArray(halfSphereVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
     }
 
     // Transformation setters
@@ -81,17 +75,18 @@ public:
         rotationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), axis);
     }
 
-private:
-    unsigned int halfSphereVAO;
-    unsigned int halfSphereVBO;
-    unsigned int halfSphereEBO;
+    // world box of what draw(shader, model) covers
+    BoundingBox bounds(glm::mat4 model = glm::mat4(1.0f)) const
+    {
+        return mesh.bounds.transformed(model * positionMatrix * rotationMatrix * scaleMatrix);
+    }
 
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
+private:
+    PrimitiveMesh mesh;
 
-    void setUpHalfSphereVertexDataAndConfigureVertexAttribute() {
-        const int sectorCount = 36;
-        const int stackCount = 18;
+    static void generateHalfSphereVerticesAndIndices(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices) {
+        const int sectorCount = key.sectors;
+        const int stackCount = key.stacks;
 
         for (int i = 0; i <= stackCount; ++i) {
             float stackAngle = glm::pi<float>() / 2 - i * glm::pi<float>() / (2 * stackCount); // Half-sphere
@@ -130,27 +125,6 @@ private:
                 indices.push_back(first + 1);
             }
         }
-
-        glGenVertexArrays(1, &halfSphereVAO);
-        glGenBuffers(1, &halfSphereVBO);
-        glGenBuffers(1, &halfSphereEBO);
-
-        glBindVertexArray(halfSphereVAO);
-
-        glBindBuffer(GL_ARRAY_BUFFER, halfSphereVBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, halfSphereEBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)12);
-        glEnableVertexAttribArray(1);
-
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)24);
-        glEnableVertexAttribArray(2);
     }
 };
 #endif // HALF_SPHERE_H
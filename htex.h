@@ -0,0 +1,208 @@
+#ifndef htex_h
+#define htex_h
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Baked texture container written by texture_bake. A fixed header, then every
+// mip level from the full image down to 1x1, each starting on a 16 byte
+// boundary, already in the layout glCompressedTexImage2D / glTexImage2D take.
+// Rows are bottom-up like stb_image's flipped load, so a baked texture
+// samples exactly as the image it came from.
+//
+// Block compressed levels are BC1 for images without alpha and BC3 for images
+// with it; images texture_bake was told not to compress, or with one or two
+// channels, are stored as plain 8 bit rows, tightly packed.
+enum HtexFormat : uint32_t {
+    HTEX_UNCOMPRESSED = 0,
+    HTEX_BC1 = 1,
+    HTEX_BC3 = 3
+};
+
+struct HtexHeader {
+    static const uint32_t maxLevels = 16;
+
+    char magic[4];          // "HTEX"
+    uint32_t version;
+    uint32_t format;        // HtexFormat
+    uint32_t channels;      // of the stored pixels, 3 or 4 when block compressed
+    uint32_t width;
+    uint32_t height;
+    uint32_t levels;
+    uint32_t reserved;
+    struct Level {
+        uint32_t offset;    // from the start of the file
+        uint32_t size;
+    } level[maxLevels];
+};
+
+const uint32_t htexVersion = 1;
+
+// bytes of a width x height level
+inline uint32_t htexLevelSize(uint32_t format, uint32_t channels, uint32_t width, uint32_t height)
+{
+    if (format == HTEX_UNCOMPRESSED)
+        return width * height * channels;
+    uint32_t blocks = ((width + 3) / 4) * ((height + 3) / 4);
+    return blocks * (format == HTEX_BC1 ? 8 : 16);
+}
+
+// concrete1.PNG -> concrete1.htex, next to the image
+inline std::string htexPath(const std::string& imagePath)
+{
+    size_t dot = imagePath.find_last_of('.');
+    size_t slash = imagePath.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return imagePath + ".htex";
+    return imagePath.substr(0, dot) + ".htex";
+}
+
+// A baked texture mapped read-only into memory, levels point straight into
+// the mapping so nothing is copied between the file and the upload.
+class HtexFile {
+public:
+    HtexFile() {}
+    HtexFile(const HtexFile&) = delete;
+    HtexFile& operator=(const HtexFile&) = delete;
+
+    ~HtexFile()
+    {
+        close();
+    }
+
+    // false if the file is missing, truncated or of another version
+    bool open(const std::string& path)
+    {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(HtexHeader))
+            return fail();
+        size = (size_t)fileSize.QuadPart;
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL)
+            return fail();
+        data = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL)
+            return fail();
+#else
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+        struct stat status;
+        if (fstat(file, &status) != 0 || status.st_size < (off_t)sizeof(HtexHeader))
+        {
+            ::close(file);
+            return false;
+        }
+        size = (size_t)status.st_size;
+        void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (mapped == MAP_FAILED)
+            return false;
+        data = (const unsigned char*)mapped;
+#endif
+        if (!valid())
+            return fail();
+        return true;
+    }
+
+    void close()
+    {
+        if (data == NULL)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+#else
+        munmap((void*)data, size);
+#endif
+        data = NULL;
+        size = 0;
+    }
+
+    bool isOpen() const
+    {
+        return data != NULL;
+    }
+
+    const HtexHeader& header() const
+    {
+        return *(const HtexHeader*)data;
+    }
+
+    const unsigned char* levelData(uint32_t level) const
+    {
+        return data + header().level[level].offset;
+    }
+
+private:
+    const unsigned char* data = NULL;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+#endif
+
+    bool valid() const
+    {
+        const HtexHeader& h = header();
+        if (std::memcmp(h.magic, "HTEX", 4) != 0 || h.version != htexVersion)
+            return false;
+        if (h.levels == 0 || h.levels > HtexHeader::maxLevels || h.width == 0 || h.height == 0)
+            return false;
+        if (h.format != HTEX_UNCOMPRESSED && h.format != HTEX_BC1 && h.format != HTEX_BC3)
+            return false;
+        if (h.channels < 1 || h.channels > 4)
+            return false;
+        uint32_t width = h.width, height = h.height;
+        for (uint32_t i = 0; i < h.levels; i++)
+        {
+            if (h.level[i].size != htexLevelSize(h.format, h.channels, width, height))
+                return false;
+            if (h.level[i].offset < sizeof(HtexHeader) || (size_t)h.level[i].offset + h.level[i].size > size)
+                return false;
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        return true;
+    }
+
+    bool fail()
+    {
+#ifdef _WIN32
+        if (data != NULL)
+            UnmapViewOfFile(data);
+        if (mapping != NULL)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data != NULL)
+            munmap((void*)data, size);
+#endif
+        data = NULL;
+        size = 0;
+        return false;
+    }
+};
+
+#endif /* htex_h */
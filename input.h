@@ -0,0 +1,45 @@
+#ifndef input_h
+#define input_h
+
+#include <GLFW/glfw3.h>
+#include <cstring>
+
+// Key presses collected from the GLFW key callback. glfwGetKey only says a
+// key is held, so a toggle read from it flips every frame the key stays down;
+// pressed() is true once per press instead, however short or long the press
+// and whatever the frame rate. Held keys (movement) still use glfwGetKey.
+class KeyboardInput {
+public:
+    static KeyboardInput& shared()
+    {
+        static KeyboardInput input;
+        return input;
+    }
+
+    void keyEvent(int key, int action)
+    {
+        if (action == GLFW_PRESS && key >= 0 && key <= GLFW_KEY_LAST)
+            presses[key] = true;
+    }
+
+    // true if key went down since the last endFrame()
+    bool pressed(int key) const
+    {
+        return key >= 0 && key <= GLFW_KEY_LAST && presses[key];
+    }
+
+    // presses are consumed once the frame has handled its input
+    void endFrame()
+    {
+        std::memset(presses, 0, sizeof(presses));
+    }
+
+private:
+    bool presses[GLFW_KEY_LAST + 1] = {};
+
+    KeyboardInput() {}
+    KeyboardInput(const KeyboardInput&) = delete;
+    KeyboardInput& operator=(const KeyboardInput&) = delete;
+};
+
+#endif /* input_h */
@@ -0,0 +1,59 @@
+#ifndef lightBlock_h
+#define lightBlock_h
+
+#include <glad/glad.h>
+#include "shader.h"
+#include "gl_handle.h"
+#include "directionalLight.h"
+
+// The Lights uniform block of fragmentShader.fs. The directional light writes
+// its current state into it once per frame and upload() sends it in a single
+// glBufferSubData, instead of one glUniform call per light member. Point and
+// spot lights go through LightClusters instead (light_clusters.h).
+class LightBlock {
+public:
+    struct Data {
+        DirectionalLightBlock directionalLight;
+    } data;
+
+    static const GLuint binding = 0;
+
+    LightBlock()
+    {
+        glGenBuffers(1, &lightUBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, lightUBO);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(Data), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, lightUBO);
+    }
+
+    ~LightBlock()
+    {
+        glDeleteBuffers(1, &lightUBO);
+    }
+
+    LightBlock(const LightBlock&) = delete;
+    LightBlock& operator=(const LightBlock&) = delete;
+
+    // point the shader's Lights block at our binding
+    void attach(const Shader& shader) const
+    {
+        shader.bindUniformBlock("Lights", binding);
+    }
+
+    void upload() const
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, lightUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Data), &data);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+private:
+    GLHandle lightUBO;
+};
+
+// offsets the std140 rules give the structs in fragmentShader.fs
+static_assert(sizeof(DirectionalLightBlock) == 64, "DirectionalLight std140 size");
+static_assert(sizeof(LightBlock::Data) == 64, "Lights std140 size");
+
+#endif /* lightBlock_h */
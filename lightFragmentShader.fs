@@ -1,9 +1,15 @@
 #version 330 core
 
 uniform vec4 bodyColor;
+//overdraw view: every fragment adds one to its pixel (overdraw_view.h)
+uniform bool overdrawPass;
 out vec4 FragColor;
 
 void main()
 {
     FragColor = bodyColor; 
+    if(overdrawPass)
+    {
+        FragColor = vec4(1.0f);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+#ifndef light_clusters_h
+#define light_clusters_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "shader.h"
+#include "gl_handle.h"
+#include "render_state.h"
+#include "pointLight.h"
+#include "spotLight.h"
+
+// Clustered forward lighting for any number of point and spot lights. The
+// view frustum is cut into tilesX x tilesY screen tiles and slices depth
+// slices, thinner near the camera (slices are even in the log of the view
+// depth). update() works out once per frame which lights reach each of these
+// clusters, and fragmentShader.fs loops over only the lights of the cluster a
+// fragment falls in, so what a fragment costs depends on the lights around it
+// rather than on how many the scene has.
+//
+// GL 3.3 has no storage buffers, so everything goes to the shader as buffer
+// textures: the lights (lightTexels RGBA32F texels each, the last one their
+// shadow in the shadow atlas, shadow_atlas.h), the first index and
+// count of every cluster (RG32UI) and the light indices of all clusters one
+// after the other (R32UI).
+//
+// A light reaches as far as its brightest color, attenuated, stays above
+// 1/256. A light that is switched off (every color zero) is left out
+// altogether. Spot lights are binned by that sphere too; the shader applies
+// the cone.
+class LightClusters {
+public:
+    static const int tilesX = 16;
+    static const int tilesY = 9;
+    static const int slices = 24;
+    static const int clusterCount = tilesX * tilesY * slices;
+    static const int lightTexels = 7;
+    // units of the lights, cells and indices, after ourTexture and ourTextureArray
+    static const int firstUnit = 2;
+
+    LightClusters()
+    {
+        glGenBuffers(3, buffers);
+        glGenTextures(3, textures);
+        const GLenum formats[3] = { GL_RGBA32F, GL_RG32UI, GL_R32UI };
+        for (int i = 0; i < 3; i++)
+        {
+            glBindBuffer(GL_TEXTURE_BUFFER, buffers[i]);
+            glBufferData(GL_TEXTURE_BUFFER, 16, NULL, GL_STREAM_DRAW);
+            activeTexture(GL_TEXTURE0 + firstUnit + i);
+            bindTexture(GL_TEXTURE_BUFFER, textures[i]);
+            glTexBuffer(GL_TEXTURE_BUFFER, formats[i], buffers[i]);
+        }
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        activeTexture(GL_TEXTURE0);
+    }
+
+    ~LightClusters()
+    {
+        deleteTextures(3, textures);
+        glDeleteBuffers(3, buffers);
+    }
+
+    LightClusters(const LightClusters&) = delete;
+    LightClusters& operator=(const LightClusters&) = delete;
+
+    // the lights are read every update(), they have to outlive the clusters;
+    // shadow is the light's number in the shadow texels, -1 for none
+    void add(const PointLight* light, int shadow = -1)
+    {
+        pointLights.push_back({ light, shadow });
+    }
+
+    void add(const SpotLight* light, int shadow = -1)
+    {
+        spotLights.push_back({ light, shadow });
+    }
+
+    // where update() finds the lights' shadow texels (ShadowAtlas::texels())
+    void setShadows(const std::vector<glm::vec4>* texels)
+    {
+        shadowTexels = texels;
+    }
+
+    // points the shader's samplers at the buffers; shader must be in use
+    void attach(const Shader& shader) const
+    {
+        shader.setInt("clusterLights", firstUnit);
+        shader.setInt("clusterCells", firstUnit + 1);
+        shader.setInt("clusterIndices", firstUnit + 2);
+    }
+
+    // bins the lights for a camera with view and a glm::perspective(fovY,
+    // aspect, nearPlane, farPlane) projection that draws into width x height pixels;
+    // shader must be in use
+    void update(const Shader& shader, const glm::mat4& view, float fovY, float aspect, float nearPlane, float farPlane, int width, int height)
+    {
+        tanY = std::tan(fovY * 0.5f);
+        tanX = tanY * aspect;
+        this->nearPlane = nearPlane;
+        this->farPlane = farPlane;
+        logScale = slices / std::log(farPlane / nearPlane);
+        logBias = -std::log(nearPlane) * logScale;
+        for (int k = 0; k <= slices; k++)
+            sliceDepth[k] = nearPlane * std::pow(farPlane / nearPlane, (float)k / slices);
+
+        counts.assign(clusterCount, 0);
+        pairs.clear();
+        texels.clear();
+        lights = 0;
+        for (const Entry<PointLight>& light : pointLights)
+        {
+            PointLightBlock block;
+            light.light->setUpLight(block);
+            float range = reach(block.ambient, block.diffuse, block.specular, block.Kc, block.Kl, block.Kq);
+            if (range <= 0.0f)
+                continue;
+            texels.push_back(glm::vec4(glm::vec3(block.position), 0.0f));
+            texels.push_back(glm::vec4(0.0f));
+            texels.push_back(block.ambient);
+            texels.push_back(block.diffuse);
+            texels.push_back(block.specular);
+            texels.push_back(glm::vec4(block.Kc, block.Kl, block.Kq, 0.0f));
+            texels.push_back(shadowTexel(light.shadow));
+            bin(lights++, glm::vec3(view * block.position), range);
+        }
+        for (const Entry<SpotLight>& light : spotLights)
+        {
+            SpotLightBlock block;
+            light.light->setUpLight(block);
+            float range = reach(block.ambient, block.diffuse, block.specular, block.Kc, block.Kl, block.Kq);
+            if (range <= 0.0f)
+                continue;
+            texels.push_back(glm::vec4(glm::vec3(block.position), 1.0f));
+            texels.push_back(glm::vec4(block.direction, block.cutOff));
+            texels.push_back(block.ambient);
+            texels.push_back(block.diffuse);
+            texels.push_back(block.specular);
+            texels.push_back(glm::vec4(block.Kc, block.Kl, block.Kq, block.outerCutOff));
+            texels.push_back(shadowTexel(light.shadow));
+            bin(lights++, glm::vec3(view * block.position), range);
+        }
+
+        // counts become first index and count per cluster, then every pair
+        // drops its light into its cluster's run
+        cells.resize(clusterCount * 2);
+        unsigned int offset = 0;
+        for (int cluster = 0; cluster < clusterCount; cluster++)
+        {
+            cells[cluster * 2] = offset;
+            cells[cluster * 2 + 1] = 0;
+            offset += counts[cluster];
+        }
+        indices.resize(std::max(offset, 1u));
+        for (const Pair& pair : pairs)
+        {
+            unsigned int& filled = cells[pair.cluster * 2 + 1];
+            indices[cells[pair.cluster * 2] + filled] = pair.light;
+            filled++;
+        }
+
+        upload(0, texels.data(), texels.size() * sizeof(glm::vec4));
+        upload(1, cells.data(), cells.size() * sizeof(unsigned int));
+        upload(2, indices.data(), indices.size() * sizeof(unsigned int));
+
+        tileSize = glm::vec2((float)width / tilesX, (float)height / tilesY);
+        setUniforms(shader);
+    }
+
+    // the last update()'s grid for another shader reading the clusters; shader
+    // must be in use
+    void setUniforms(const Shader& shader) const
+    {
+        shader.setVec2("clusterTileSize", tileSize);
+        shader.setFloat("clusterLogScale", logScale);
+        shader.setFloat("clusterLogBias", logBias);
+    }
+
+    // lights added, and those lit and binned by the last update()
+    int lightCount() const
+    {
+        return (int)(pointLights.size() + spotLights.size());
+    }
+
+    int activeLights() const
+    {
+        return lights;
+    }
+
+    // light references over all clusters
+    int indexCount() const
+    {
+        return (int)pairs.size();
+    }
+
+    // distance at which the light's brightest color falls below 1/256, 0 for
+    // a light that is off and FLT_MAX for one that does not fall off
+    static float reach(const glm::vec4& ambient, const glm::vec4& diffuse, const glm::vec4& specular, float Kc, float Kl, float Kq)
+    {
+        float brightest = 0.0f;
+        for (int c = 0; c < 3; c++)
+            brightest = std::max(brightest, std::max(ambient[c], std::max(diffuse[c], specular[c])));
+        if (brightest <= 0.0f)
+            return 0.0f;
+        // 1 / (Kc + Kl d + Kq d^2) * brightest = 1/256
+        float threshold = 256.0f * brightest;
+        if (Kc >= threshold)
+            return 0.0f;
+        if (Kq > 0.0f)
+            return (-Kl + std::sqrt(Kl * Kl + 4.0f * Kq * (threshold - Kc))) / (2.0f * Kq);
+        if (Kl > 0.0f)
+            return (threshold - Kc) / Kl;
+        return FLT_MAX;
+    }
+
+private:
+    struct Pair {
+        unsigned int cluster;
+        unsigned int light;
+    };
+
+    template <typename T>
+    struct Entry {
+        const T* light;
+        int shadow;
+    };
+
+    std::vector<Entry<PointLight>> pointLights;
+    std::vector<Entry<SpotLight>> spotLights;
+    const std::vector<glm::vec4>* shadowTexels = nullptr;
+    // rebuilt every update(), kept to reuse their storage
+    std::vector<glm::vec4> texels;
+    std::vector<unsigned int> counts;
+    std::vector<unsigned int> cells;
+    std::vector<unsigned int> indices;
+    std::vector<Pair> pairs;
+    int lights = 0;
+    float tanX = 1.0f, tanY = 1.0f;
+    float nearPlane = 0.1f, farPlane = 100.0f;
+    float logScale = 1.0f, logBias = 0.0f;
+    glm::vec2 tileSize = glm::vec2(1.0f);
+    float sliceDepth[slices + 1];
+    GLuint buffers[3];
+    GLuint textures[3];
+
+    glm::vec4 shadowTexel(int shadow) const
+    {
+        if (shadowTexels == nullptr || shadow < 0)
+            return glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f);
+        return (*shadowTexels)[shadow];
+    }
+
+    int sliceOf(float depth) const
+    {
+        return std::max(0, std::min(slices - 1, (int)std::floor(std::log(depth) * logScale + logBias)));
+    }
+
+    int tileOf(float ndc, int tiles) const
+    {
+        return std::max(0, std::min(tiles - 1, (int)std::floor((ndc + 1.0f) * 0.5f * tiles)));
+    }
+
+    // adds light to every cluster its sphere (view space) touches
+    void bin(unsigned int light, const glm::vec3& center, float radius)
+    {
+        float depth = -center.z;
+        float nearest = depth - radius, farthest = depth + radius;
+        if (farthest < nearPlane || nearest > farPlane)
+            return;
+        int k0 = sliceOf(std::max(nearest, nearPlane)), k1 = sliceOf(std::min(farthest, farPlane));
+
+        // tiles the sphere's box covers on screen, every tile when the box
+        // reaches behind the camera
+        int x0 = 0, x1 = tilesX - 1, y0 = 0, y1 = tilesY - 1;
+        if (nearest > 0.0f)
+        {
+            float minX = FLT_MAX, maxX = -FLT_MAX, minY = FLT_MAX, maxY = -FLT_MAX;
+            for (float d : { nearest, farthest })
+                for (float side : { -radius, radius })
+                {
+                    minX = std::min(minX, (center.x + side) / (tanX * d));
+                    maxX = std::max(maxX, (center.x + side) / (tanX * d));
+                    minY = std::min(minY, (center.y + side) / (tanY * d));
+                    maxY = std::max(maxY, (center.y + side) / (tanY * d));
+                }
+            if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f)
+                return;
+            x0 = tileOf(minX, tilesX);
+            x1 = tileOf(maxX, tilesX);
+            y0 = tileOf(minY, tilesY);
+            y1 = tileOf(maxY, tilesY);
+        }
+
+        float radiusSquared = radius == FLT_MAX ? FLT_MAX : radius * radius;
+        for (int k = k0; k <= k1; k++)
+        {
+            float zn = sliceDepth[k], zf = sliceDepth[k + 1];
+            float dz = std::max(0.0f, std::max(zn - depth, depth - zf));
+            for (int y = y0; y <= y1; y++)
+            {
+                float ndcY0 = -1.0f + 2.0f * y / tilesY, ndcY1 = -1.0f + 2.0f * (y + 1) / tilesY;
+                float lowY = std::min(ndcY0 * tanY * zn, ndcY0 * tanY * zf), highY = std::max(ndcY1 * tanY * zn, ndcY1 * tanY * zf);
+                float dy = std::max(0.0f, std::max(lowY - center.y, center.y - highY));
+                for (int x = x0; x <= x1; x++)
+                {
+                    float ndcX0 = -1.0f + 2.0f * x / tilesX, ndcX1 = -1.0f + 2.0f * (x + 1) / tilesX;
+                    float lowX = std::min(ndcX0 * tanX * zn, ndcX0 * tanX * zf), highX = std::max(ndcX1 * tanX * zn, ndcX1 * tanX * zf);
+                    float dx = std::max(0.0f, std::max(lowX - center.x, center.x - highX));
+                    if (dx * dx + dy * dy + dz * dz > radiusSquared)
+                        continue;
+                    unsigned int cluster = x + tilesX * (y + tilesY * k);
+                    counts[cluster]++;
+                    pairs.push_back({ cluster, light });
+                }
+            }
+        }
+    }
+
+    // fresh storage every frame, so the driver never waits for last frame's
+    // draws to finish reading the old one
+    void upload(int buffer, const void* data, size_t bytes)
+    {
+        glBindBuffer(GL_TEXTURE_BUFFER, buffers[buffer]);
+        glBufferData(GL_TEXTURE_BUFFER, std::max(bytes, (size_t)16), NULL, GL_STREAM_DRAW);
+        if (bytes > 0)
+            glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, data);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+};
+
+#endif /* light_clusters_h */
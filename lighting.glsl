@@ -0,0 +1,297 @@
+// Lights, materials and shadows shared by fragmentShader.fs and the lighting
+// pass of deferredFragmentShader.fs. Shader expands the #include of this file
+// when it loads either of them, so both light a surface the same way.
+
+struct Material {
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 specular;
+    float shininess;
+};
+
+struct PointLight {              //Point Light
+    vec3 position;
+
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 specular;
+
+    float Kc;
+    float Kl;
+    float Kq;
+
+};
+
+struct DirectionalLight {              //Directional Light
+    vec3 direction;
+
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 specular;
+};
+
+struct SpotLight {                    //Spot Light
+    vec3 position;
+    vec3 direction;
+    float cutOff;
+    float outerCutOff;
+
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 specular;
+
+    float Kc;
+    float Kl;
+    float Kq;
+};
+
+//The directional light is uploaded once per frame as a std140 block (lightBlock.h)
+layout (std140) uniform Lights {
+    DirectionalLight directionalLight;
+};
+
+//Point and spot lights are binned into view space clusters every frame
+//(light_clusters.h): 7 texels per light, first index and count per cluster,
+//and the light indices of every cluster one after the other
+uniform samplerBuffer clusterLights;
+uniform usamplerBuffer clusterCells;
+uniform usamplerBuffer clusterIndices;
+uniform vec2 clusterTileSize;
+uniform float clusterLogScale;
+uniform float clusterLogBias;
+const ivec3 clusterGrid = ivec3(16, 9, 24);
+
+//shadows of the directional light (cascaded_shadow_map.h): a layer per
+//cascade, picked by view depth
+uniform sampler2DArrayShadow shadowMap;
+uniform bool shadowsOn;
+uniform mat4 cascadeLightSpace[3];
+uniform float cascadeEnds[3];
+uniform float cascadeTexels[3];
+
+//shadows of the point and spot lights (shadow_atlas.h): a tile per spot light
+//and six per point light, the cube faces, found from the light's shadow texel
+uniform sampler2DShadow shadowAtlas;
+const int shadowAtlasTiles = 256;
+const int shadowAtlasTileSize = 256;
+const float shadowAtlasNear = 0.05f;
+
+//every material of the scene, a draw picks one by index (material_table.h)
+layout (std140) uniform Materials {
+    Material materials[256];
+};
+
+//for the specular terms
+uniform vec3 viewPos;
+
+vec4 CalcDirLight(Material material, DirectionalLight light, vec3 normal, vec3 fragPos, float lit)
+{
+    vec4 ambient = light.ambient * material.ambient;
+    vec3 norm = normalize(normal);
+
+    vec3 lightDir = normalize(-light.direction);
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec4 diffuse = light.diffuse * (diff * material.diffuse);
+
+    vec3 viewDir = normalize(viewPos - fragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    vec4 specular = light.specular * (spec * material.specular);
+
+    return (ambient + lit * (diffuse + specular));
+}
+
+//how much of the directional light reaches fragPos, 0 to 1: nine taps of the
+//cascade's layer around where the fragment lands in it, each a 2x2 filtered
+//depth compare. The fragment is pushed off its surface by a texel and a half
+//so the surface does not shadow itself
+float CalcShadow(vec3 normal, vec3 fragPos, float viewDepth)
+{
+    if(!shadowsOn)
+    {
+        return 1.0f;
+    }
+    int cascade = 0;
+    while(cascade < 3 && viewDepth > cascadeEnds[cascade])
+    {
+        cascade++;
+    }
+    if(cascade == 3)
+    {
+        return 1.0f;
+    }
+    vec3 position = fragPos + normalize(normal) * cascadeTexels[cascade] * 1.5f;
+    vec3 coords = (cascadeLightSpace[cascade] * vec4(position, 1.0f)).xyz * 0.5f + 0.5f;
+    float texel = 1.0f / float(textureSize(shadowMap, 0).x);
+    float lit = 0.0f;
+    for(int x = -1; x <= 1; x++)
+    {
+        for(int y = -1; y <= 1; y++)
+        {
+            lit += texture(shadowMap, vec4(coords.xy + vec2(x, y) * texel, float(cascade), min(coords.z, 1.0f)));
+        }
+    }
+    return lit / 9.0f;
+}
+
+//how much of a point or spot light reaches fragPos, 0 to 1, from its shadow
+//texel (shadow_atlas.h). A point light's cube face is the one along the
+//largest axis from the light to the fragment; the fragment is projected the
+//way that face, or the spot light, was drawn and filtered with nine taps
+//kept inside the tile
+float CalcLightShadow(vec4 shadow, vec3 lightPos, vec3 spotDirection, bool spot, vec3 normal, vec3 fragPos)
+{
+    if(shadow.x < 0.0f)
+    {
+        return 1.0f;
+    }
+    vec3 toFrag = fragPos - lightPos;
+    vec3 forward;
+    float tile;
+    float tanHalf = 1.0f;
+    if(spot)
+    {
+        forward = normalize(spotDirection);
+        tile = shadow.x;
+        tanHalf = shadow.y;
+    }
+    else
+    {
+        vec3 distance = abs(toFrag);
+        int face;
+        if(distance.x >= distance.y && distance.x >= distance.z)
+        {
+            face = toFrag.x > 0.0f ? 0 : 1;
+            forward = vec3(toFrag.x > 0.0f ? 1.0f : -1.0f, 0.0f, 0.0f);
+        }
+        else if(distance.y >= distance.z)
+        {
+            face = toFrag.y > 0.0f ? 2 : 3;
+            forward = vec3(0.0f, toFrag.y > 0.0f ? 1.0f : -1.0f, 0.0f);
+        }
+        else
+        {
+            face = toFrag.z > 0.0f ? 4 : 5;
+            forward = vec3(0.0f, 0.0f, toFrag.z > 0.0f ? 1.0f : -1.0f);
+        }
+        float pair = face < 2 ? shadow.x : (face < 4 ? shadow.y : shadow.z);
+        tile = (face & 1) == 0 ? mod(pair, float(shadowAtlasTiles)) : floor(pair / float(shadowAtlasTiles));
+    }
+    vec3 up = abs(forward.y) > 0.99f ? vec3(0.0f, 0.0f, 1.0f) : vec3(0.0f, 1.0f, 0.0f);
+    vec3 right = normalize(cross(forward, up));
+    up = cross(right, forward);
+
+    //pushed off the surface by a texel and a half at the fragment's distance
+    float depth = dot(toFrag, forward);
+    toFrag += normalize(normal) * (2.0f * depth * tanHalf / float(shadowAtlasTileSize)) * 1.5f;
+    depth = dot(toFrag, forward);
+    if(depth <= shadowAtlasNear || depth >= shadow.w)
+    {
+        return 1.0f;
+    }
+    vec2 ndc = vec2(dot(toFrag, right), dot(toFrag, up)) / (depth * tanHalf);
+    if(spot && (abs(ndc.x) > 1.0f || abs(ndc.y) > 1.0f))
+    {
+        return 1.0f;
+    }
+    //the depth the face's glm::perspective wrote at that distance
+    float far = shadow.w;
+    float z = ((far + shadowAtlasNear) / (far - shadowAtlasNear) - 2.0f * far * shadowAtlasNear / ((far - shadowAtlasNear) * depth)) * 0.5f + 0.5f;
+
+    float tilesPerRow = float(textureSize(shadowAtlas, 0).x / shadowAtlasTileSize);
+    vec2 corner = vec2(mod(tile, tilesPerRow), floor(tile / tilesPerRow)) * float(shadowAtlasTileSize);
+    vec2 inside = (ndc * 0.5f + 0.5f) * float(shadowAtlasTileSize);
+    float texel = 1.0f / float(textureSize(shadowAtlas, 0).x);
+    float lit = 0.0f;
+    for(int x = -1; x <= 1; x++)
+    {
+        for(int y = -1; y <= 1; y++)
+        {
+            vec2 tap = clamp(inside + vec2(x, y), vec2(1.0f), vec2(float(shadowAtlasTileSize) - 1.0f));
+            lit += texture(shadowAtlas, vec3((corner + tap) * texel, z));
+        }
+    }
+    return lit / 9.0f;
+}
+
+vec4 CalcPointLight(Material material, PointLight light, vec3 normal, vec3 fragPos, float lit)
+{
+    float distance = length(light.position - fragPos);
+    float attenuation = 1.0 / (light.Kc + light.Kl * distance + light.Kq * (distance * distance));
+
+    vec4 ambient = light.ambient * material.ambient;
+    ambient *= attenuation;
+
+    vec3 norm = normalize(normal);
+    vec3 lightDir = normalize(light.position - fragPos);
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec4 diffuse = light.diffuse * (diff * material.diffuse);
+    diffuse *= attenuation;
+
+    vec3 viewDir = normalize(viewPos - fragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    vec4 specular = light.specular * (spec * material.specular);
+    specular *= attenuation;
+
+    return (ambient + lit * (diffuse + specular));
+}
+
+vec4 CalcSpotLight(Material material, SpotLight light, vec3 normal, vec3 fragPos, float lit)
+{
+    float distance = length(light.position - fragPos);
+    float attenuation = 1.0 / (light.Kc + light.Kl * distance + light.Kq * (distance * distance));
+
+    vec4 ambient = light.ambient * material.ambient;
+    ambient *= attenuation;
+
+    vec3 norm = normalize(normal);
+    vec3 lightDir = normalize(light.position - fragPos);
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec4 diffuse = light.diffuse * (diff * material.diffuse);
+    diffuse *= attenuation;
+
+    vec3 viewDir = normalize(viewPos - fragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    vec4 specular = light.specular * (spec * material.specular);
+    specular *= attenuation;
+
+    float theta = dot(lightDir, normalize(-light.direction));
+    float epsilon = light.cutOff - light.outerCutOff;
+    float intensity = clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
+    ambient *= intensity;
+    diffuse *= intensity;
+    specular *= intensity;
+
+    return (ambient + lit * (diffuse + specular));
+}
+
+//every point and spot light of the cluster fragPos falls in, from the lists
+//light_clusters.h built this frame
+vec4 CalcClusterLights(Material material, vec3 normal, vec3 fragPos, float viewDepth)
+{
+    ivec2 tile = min(ivec2(gl_FragCoord.xy / clusterTileSize), clusterGrid.xy - 1);
+    int slice = clamp(int(floor(log(viewDepth) * clusterLogScale + clusterLogBias)), 0, clusterGrid.z - 1);
+    uvec2 cell = texelFetch(clusterCells, tile.x + clusterGrid.x * (tile.y + clusterGrid.y * slice)).rg;
+    vec4 localL = vec4(0.0f);
+    for(uint i = 0u; i < cell.y; i++)
+    {
+        int light = int(texelFetch(clusterIndices, int(cell.x + i)).r) * 7;
+        vec4 position = texelFetch(clusterLights, light);
+        vec4 direction = texelFetch(clusterLights, light + 1);
+        vec4 falloff = texelFetch(clusterLights, light + 5);
+        float lit = CalcLightShadow(texelFetch(clusterLights, light + 6), position.xyz, direction.xyz, position.w != 0.0f, normal, fragPos);
+        if(position.w == 0.0f)
+        {
+            PointLight pointLight = PointLight(position.xyz, texelFetch(clusterLights, light + 2), texelFetch(clusterLights, light + 3), texelFetch(clusterLights, light + 4), falloff.x, falloff.y, falloff.z);
+            localL += CalcPointLight(material, pointLight, normal, fragPos, lit);
+        }
+        else
+        {
+            SpotLight spotLight = SpotLight(position.xyz, direction.xyz, direction.w, falloff.w, texelFetch(clusterLights, light + 2), texelFetch(clusterLights, light + 3), texelFetch(clusterLights, light + 4), falloff.x, falloff.y, falloff.z);
+            localL += CalcSpotLight(material, spotLight, normal, fragPos, lit);
+        }
+    }
+    return localL;
+}
@@ -10,6 +10,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cfloat>
 #include "sphere.h"
 #include "bezier2.h"
 #include "sphere2.h"
@@ -20,6 +21,13 @@
 #include "directionalLight.h"
 #include "pointLight.h"
 #include "spotLight.h"
+#include "lightBlock.h"
+#include "light_clusters.h"
+#include "deferred_renderer.h"
+#include "overdraw_view.h"
+#include "cascaded_shadow_map.h"
+#include "shadow_atlas.h"
+#include "material_table.h"
 #include "wheel.h"
 #include "stb_image.h"
 #include "bezier.h"
@@ -29,9 +37,24 @@
 #include  "capsule.h"
 #include  "curved_pipe.h"
 #include "fractal.h"
+#include "static_batch.h"
+#include "cube_commands.h"
+#include "transform_system.h"
+#include "animation.h"
+#include "frustum.h"
+#include "portal.h"
+#include "render_state.h"
+#include "alloc_counter.h"
+#include "benchmark.h"
+#include "input.h"
+#include "texture_loader.h"
+#include "texture_manager.h"
 #include <iostream>
 #include <stdlib.h>
-#include<windows.h>  
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <algorithm>
 
 using namespace std;
 
@@ -40,53 +63,67 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void sign_board(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
 
 void line_strip(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void xray_lathi(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void pat_lathi(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void xray_danda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void Lift(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void entrancegate(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void book_self(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void stool(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void MRI(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere sphere);
-void hospital(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void pat_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void AC_1(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void sofa(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-
-
-void mri_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void xray_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void pat_chair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void wheelChair(Shader ourShader, glm::mat4 moveMatrix,glm::vec4 color);
-void computer(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void doc_table(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void danda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void slide(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void staircase(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void baki_floor(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void glass_window(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void pillers(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void doc_chair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void door(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void xray_lathi(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void pat_lathi(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void xray_danda(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void Lift(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void entrancegate(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void updateEntranceGate();
+void defineAnimations();
+void book_self(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void stool(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void MRI(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere& sphere);
+void updateMRI();
+void hospital(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void pat_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void AC_1(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void sofa(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+
+
+void mri_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void xray_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void pat_chair(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void wheelChair(Shader& ourShader, glm::mat4 moveMatrix,glm::vec4 color);
+void computer(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void doc_table(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void danda(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void slide(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void staircase(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void baki_floor(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void glass_window(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void pillers(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void doc_chair(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void door(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
 void mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
-void processInput(GLFWwindow* window, Wheel& mywheel, Wheel& mywheel1,
-    Wheel& mywheel2, Wheel& mywheel3);
-void Bed(Shader ourshader, glm::mat4 moveMatrix);
-void porda(Shader ourshader, glm::mat4 moveMatrix, glm::vec4 color);
-void Chair(Shader ourShader, glm::mat4 moveMatrix);
-void Floor(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void sperateWall(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void Fan1(Shader ourShader, glm::mat4 moveMatrix);
-void drawCube(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, float spec, float shininess);
-void carpet(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void Boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void outside_boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void Gate(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color);
-void GuardRoom(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture);
-void Shop(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture);
-void LampPost(Shader ourShader, glm::mat4 moveMatrix);
-void load_texture(unsigned int& texture, string image_name, GLenum format, bool repeat);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
+void processInput(GLFWwindow* window);
+void Bed(Shader& ourshader, glm::mat4 moveMatrix);
+void porda(Shader& ourshader, glm::mat4 moveMatrix, glm::vec4 color);
+void Chair(Shader& ourShader, glm::mat4 moveMatrix);
+void Floor(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void sperateWall(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void Fan1(Shader& ourShader, glm::mat4 moveMatrix);
+void drawCube(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, float spec, float shininess);
+void drawCubeElements(Shader& ourShader);
+void defineMaterials();
+void setMaterial(Shader& ourShader, int material);
+void setMaterial(Shader& ourShader, const char* name);
+void setMaterial(Shader& ourShader, glm::vec4 ambient, glm::vec4 diffuse, glm::vec4 specular, float shininess);
+void drawStaticScene(Shader& ourShader);
+void recordPrototype(StaticBatch& batch, Shader& ourShader, void (*object)(Shader&, glm::mat4, glm::vec4));
+BoundingBox measureObject(Shader& ourShader, void (*object)(Shader&, glm::mat4, glm::vec4));
+bool isVisible(const BoundingBox& box);
+void buildHospitalCells(CellGraph& cells);
+void addWardLights(std::vector<PointLight>& lights, const CellGraph& cells);
+void carpet(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void Boundary(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void outside_boundary(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void Gate(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color);
+void GuardRoom(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture);
+void Shop(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture);
+void LampPost(Shader& ourShader, glm::mat4 moveMatrix);
+void load_texture(const char* name, string image_name, GLenum format, bool repeat);
 // Function to generate a cylinder geometry (simplified version)
 void generateCylinder(std::vector<float>& vertices, std::vector<unsigned int>& indices, float radius, float height, unsigned int sectors);
 GLuint createBufferObject(std::vector<float>& data, GLenum usage) {
@@ -118,6 +155,9 @@ float wheelX4 = 0.0;
 // settings
 const unsigned int SCR_WIDTH = 1500;
 const unsigned int SCR_HEIGHT = 800;
+// pixels actually drawn, larger than the window on high DPI screens
+int framebufferWidth = SCR_WIDTH;
+int framebufferHeight = SCR_HEIGHT;
 
 // modelling transform
 float rotateAngle_X = 0.0;
@@ -135,24 +175,30 @@ float scale_Z = 1.0;
 
 float rotateAngleTest_Y = 0.0;
 
+//speeds are per second, the animations below move these values
 bool mriInside = false;
 float mriTranslate = 0.0f;
-float mriSpeed = 0.001f;
-float mriRotateAngle = 0.0f;
+float mriSpeed = 0.6f;
 
 bool isLiftOpening = false;
 bool isLiftGoingUp = false;
 float liftOpeningSpeed = 0.01f;
 float liftOpenCurrent = 0.0f;
 float liftUpCurrent = 0.0f;
-float liftUpSpeed = 0.01f;
+float liftUpSpeed = 0.6f;
 
 bool isgateOpening = false;
 
-float gateOpeningSpeed = 0.01f;
+float gateOpeningSpeed = 0.6f;
 float gateOpenCurrent = 0.0f;
 float xraypos = 0;
-float signxray = 1;
+float movemribed = 0;
+float patbedangle = 0;
+
+//everything that moves, stepped once per frame before drawing
+AnimationSystem animations;
+int gateAnimation, liftAnimation, mriAnimation, mriBedAnimation, xrayAnimation, patBedAnimation;
+int cartAnimation, doorAnimation, door1Animation, fanAnimation;
 
 // camera               8.0   1.0   18.1
 Camera camera(glm::vec3(5.0f, 5.0f, 40.1f));
@@ -168,6 +214,7 @@ BasicCamera basic_camera(eyeX, eyeY, eyeZ, lookAtX, lookAtY, lookAtZ, V);
 // timing
 float deltaTime = 0.0f;    // time between current frame and last frame
 float lastFrame = 0.0f;
+float lastTitleUpdate = 0.0f;
 
 
 glm::vec3 lightPositions[] = {
@@ -186,6 +233,8 @@ glm::vec3 lightDirections[] = {
 DirectionalLight directionalLight(-lightPositions[0], glm::vec4(0.4f, 0.4f, 0.4f, 1.0f), glm::vec4(0.9f, 0.9f, 0.9f, 1.0f), glm::vec4(0.2f, 0.2f, 0.2f, 0.2f), 1);
 SpotLight spotLight(lightPositions[2], lightDirections[0], 8.5f, 15.5f, glm::vec4(0.2f, 0.2f, 0.2f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), 1.0f, 0.0014f, 0.000007f, 1);
 PointLight pointLight(lightPositions[1], glm::vec4(0.2f, 0.2f, 0.2f, 1.0f), glm::vec4(0.9f, 0.9f, 0.9f, 1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), 1.0f, 0.09f, 0.032f, 1);
+//ceiling lights of the rooms, corridors and wards, switched with the point light
+std::vector<PointLight> wardLights;
 
 // texture
 float extra = 4.0f;
@@ -196,15 +245,58 @@ float TYmax = 1.0f + extra;
 
 
 
+//static scene bake
+StaticBatch* cubeRecorder = NULL;
+//moving objects queue their cubes here during the frame, see CubeCommands
+CubeCommands* cubeQueue = NULL;
+
+//frustum culling: the view of the current frame, what it skipped, and the box
+//drawCubeElements grows while an object is being measured
+Frustum viewFrustum;
+CullCounters cullCounters;
+BoundingBox* boundsRecorder = NULL;
+BoundingBox cubeBounds;
+
+//rooms of the hospital and the doors between them, see buildHospitalCells()
+CellGraph hospitalCells;
+//the rooms isVisible() tests against; shadow passes switch to a graph without
+//cells, since what the camera cannot see still casts into what it can
+const CellGraph* cullCells = &hospitalCells;
+CellGraph noCells;
+
+//--wards N: stress mode, N extra wards of 40 instanced beds
+int stressWards = 0;
+
+//ourShader uniform handles, resolved once after linking
+GLint modelLoc = -1;
+GLint materialIndexLoc = -1;
+
+//every material ourShader draws with, a draw only sets materialIndex
+MaterialTable materialTable;
+
 //rotate
 bool isRotating = false;
-float fanSpeed = 8.0f;
+float fanSpeed = 480.0f;
 
 bool lightingOn = true;
 float ambientOn = 1.0;
 float diffuseOn = 1.0;
 float specularOn = 1.0;
 bool dark = false;
+//I or --shading deferred: light the G-buffer once per pixel instead of every fragment as it is drawn
+bool deferredShading = false;
+//F1 or --prepass on: lay down the opaque scene's depth before shading it
+bool depthPrepass = false;
+//F2 or --order front-to-back: draw the opaque batches nearest to the camera first
+bool frontToBack = false;
+//F3 or --overdraw on: show how many fragments each pixel got instead of the scene
+bool showOverdraw = false;
+//F4 or --shadows off: the directional light casts cascaded shadows
+bool directionalShadows = true;
+//F5 or --light-shadows off: the point and spot lights cast shadows from the shadow atlas,
+//--shadow-faces drawn at most a frame
+bool lightShadows = true;
+int shadowFacesPerFrame = 12;
 
 float directionalLightOn = 1.0;
 float pointLightOn = 0.0;
@@ -262,43 +354,20 @@ std::vector<float> generateSalinePacketControlPoints(float width, float height,
 
 
 // Textures
-unsigned int texture0, texture1, texture2, texture3, texture4, texture5, texture6, texture7, texture8, texture9, texture10, texture11, texture12, texture13, texture14, texture15,texture16,texture17;
-unsigned int loadTexture(char const* path, GLenum textureWrappingModeS, GLenum textureWrappingModeT, GLenum textureFilteringModeMin, GLenum textureFilteringModeMax)
+//Every image file goes through the loader: decoded on worker threads, uploaded a
+//few per frame from the render loop, grey until then
+TextureLoader textureLoader;
+//Baked textures keep only the mip levels the camera needs, within --texture-budget
+TextureStreamer textureStreamer;
+//Textures are looked up by name, an image used under several names is loaded once
+TextureManager textureManager(textureLoader);
+unsigned int tex(const char* name)
 {
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(path, &width, &height, &nrComponents, 0);
-    if (data)
-    {
-        GLenum format;
-        if (nrComponents == 1)
-            format = GL_RED;
-        else if (nrComponents == 3)
-            format = GL_RGB;
-        else if (nrComponents == 4)
-            format = GL_RGBA;
-
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrappingModeS);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrappingModeT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilteringModeMin);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilteringModeMax);
-
-        stbi_image_free(data);
-    }
-    else
-    {
-        std::cout << "Texture failed to load at path: " << path << std::endl;
-        stbi_image_free(data);
-    }
-
-    return textureID;
+    return textureManager.get(name);
+}
+unsigned int loadTexture(const char* name, char const* path, GLenum textureWrappingModeS, GLenum textureWrappingModeT, GLenum textureFilteringModeMin, GLenum textureFilteringModeMax)
+{
+    return textureManager.acquire(name, path, 0, { textureWrappingModeS, textureWrappingModeT, textureFilteringModeMin, textureFilteringModeMax });
 }
 
 //////////////tamim
@@ -315,49 +384,156 @@ glm::mat4 transform(float tr_x, float tr_y, float tr_z, float rot_x, float rot_y
     return model;
 }
 
-int main()
+int main(int argc, char** argv)
 {
-    // glfw: initialize and configure
-    // ------------------------------
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    std::chrono::steady_clock::time_point programStart = std::chrono::steady_clock::now();
+#ifdef HOSPITAL_BENCHMARK
+    const char* benchmarkPath = "walkthrough.path";
+#else
+    const char* benchmarkPath = NULL;
 #endif
+    const char* benchmarkCsv = "benchmark.csv";
+    bool invertNormalsInShader = false;
+    bool vertexStageOnly = false;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--wards") == 0)
+            stressWards = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--benchmark") == 0)
+            benchmarkPath = argv[i + 1];
+        else if (strcmp(argv[i], "--csv") == 0)
+            benchmarkCsv = argv[i + 1];
+        else if (strcmp(argv[i], "--texture-budget") == 0)
+            textureStreamer.setBudget((size_t)atoi(argv[i + 1]) * 1024 * 1024);
+        else if (strcmp(argv[i], "--normals") == 0)
+            invertNormalsInShader = strcmp(argv[i + 1], "shader") == 0;
+        else if (strcmp(argv[i], "--stage") == 0)
+            vertexStageOnly = strcmp(argv[i + 1], "vertex") == 0;
+        else if (strcmp(argv[i], "--lights") == 0)
+            pointLightOn = strcmp(argv[i + 1], "on") == 0 ? 1.0f : 0.0f;
+        else if (strcmp(argv[i], "--shading") == 0)
+            deferredShading = strcmp(argv[i + 1], "deferred") == 0;
+        else if (strcmp(argv[i], "--prepass") == 0)
+            depthPrepass = strcmp(argv[i + 1], "on") == 0;
+        else if (strcmp(argv[i], "--order") == 0)
+            frontToBack = strcmp(argv[i + 1], "front-to-back") == 0;
+        else if (strcmp(argv[i], "--overdraw") == 0)
+            showOverdraw = strcmp(argv[i + 1], "on") == 0;
+        else if (strcmp(argv[i], "--shadows") == 0)
+            directionalShadows = strcmp(argv[i + 1], "off") != 0;
+        else if (strcmp(argv[i], "--light-shadows") == 0)
+            lightShadows = strcmp(argv[i + 1], "off") != 0;
+        else if (strcmp(argv[i], "--shadow-faces") == 0)
+            shadowFacesPerFrame = atoi(argv[i + 1]);
+    }
 
-    // glfw window creation
-    // --------------------
-    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Hospital-1907086", NULL, NULL);
-    if (window == NULL)
+    // --benchmark <path>: no window and no keyboard, the camera flies the
+    // recorded path at fixed steps and every frame is measured
+    // --stage vertex: benchmark frames discard everything after the vertex
+    // shader, so gpu ms is vertex processing alone
+    // --normals shader: invert the model matrix per vertex again instead of
+    // using the normal matrix Shader works out, to compare the two
+    // --lights on: start with the point light and every ward light on
+    // --shading deferred: start with deferred shading, to compare its cost with forward
+    // --prepass on, --order front-to-back: start with the depth pre-pass or
+    // with the opaque scene sorted, --overdraw on: with the overdraw heatmap,
+    // whose average the benchmark then reports
+    // --shadows off: without directional light shadows, to see what they cost
+    // --light-shadows off: without point and spot light shadows, --shadow-faces <n>:
+    // draw at most n of their faces a frame
+    CameraPath cameraPath;
+    if (benchmarkPath != NULL && !cameraPath.load(benchmarkPath))
     {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
+        std::cout << "Failed to read camera path " << benchmarkPath << std::endl;
         return -1;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    //glfwSetCursorPosCallback(window, mouse_callback);
-    glfwSetScrollCallback(window, scroll_callback);
-
-    // tell GLFW to capture our mouse
-    //glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
-    // glad: load all OpenGL function pointers
-    // ---------------------------------------
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    GLFWwindow* window = NULL;
+    HeadlessContext headless;
+    if (benchmarkPath != NULL)
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
+        if (!headless.create(SCR_WIDTH, SCR_HEIGHT))
+            return -1;
+    }
+    else
+    {
+        // glfw: initialize and configure
+        // ------------------------------
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+        // glfw window creation
+        // --------------------
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Hospital-1907086", NULL, NULL);
+        if (window == NULL)
+        {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        //glfwSetCursorPosCallback(window, mouse_callback);
+        glfwSetScrollCallback(window, scroll_callback);
+        glfwSetKeyCallback(window, key_callback);
+
+        // tell GLFW to capture our mouse
+        //glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+
+        // glad: load all OpenGL function pointers
+        // ---------------------------------------
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return -1;
+        }
     }
    
+    // Texture loading
+    //Everything is requested before the first object is built, the objects keep
+    //the texture IDs they are given
+
+    textureLoader.setStreamer(&textureStreamer);
+    string diffuseMapPathUni = "glass.jpg";
+    string specularMapPathUni = "glass.jpg";
+    unsigned int diffMap = loadTexture("glassDiffuse", diffuseMapPathUni.c_str(), GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
+    unsigned int specMap = loadTexture("glassSpecular", specularMapPathUni.c_str(), GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
+    std::cout << "Diffuse Map Path: " << diffuseMapPathUni << std::endl;
+    std::cout << "Specular Map Path: " << specularMapPathUni << std::endl;
+
+    load_texture("transparent", "transparent.png", GL_RGBA, true);
+    load_texture("floor", "floor2.jpg", GL_RGB, true);
+    load_texture("wall", "wall3.jpg", GL_RGB, true);
+    load_texture("wood", "wood.jpg", GL_RGB, true);
+    load_texture("concrete", "concrete1.PNG", GL_RGBA, true);
+    load_texture("stairs", "stair_upper.jpg", GL_RGB, true);
+    load_texture("concrete2", "concrete2.PNG", GL_RGBA, true);
+    load_texture("gateWood", "wood.jpg", GL_RGB, true);
+    load_texture("stick", "stick.jpg", GL_RGB, true);
+    load_texture("sofa", "sofa.jpg", GL_RGB, true);
+    load_texture("entranceWood", "wood.jpg", GL_RGB, true);
+    load_texture("sky", "sky.jpg", GL_RGB, true);
+    load_texture("road", "road.jpg", GL_RGB, true);
+    load_texture("bed", "bed.jpg", GL_RGB, true);
+    load_texture("water", "water.jpeg", GL_RGB, true);
+    load_texture("wheelchair", "wheelchair.jpeg", GL_RGB, true);
+    textureLoader.start();
+    std::cout << textureManager.textureCount() << " textures for " << textureManager.requestCount() << " texture names" << std::endl;
+
               // Position of the wheel;
     Wheel mywheel;
     Wheel mywheel1;
     Wheel mywheel2;
     Wheel mywheel3;
+    //the wheels move with the cart, the shadow cascades draw them every frame
+    Wheel* cartWheels[] = { &mywheel, &mywheel1, &mywheel2, &mywheel3 };
 
     // Apply transformations to the Wheel
     mywheel.setPosition(glm::vec3(12.66f+wheelX1, -0.3f, -2.94f)); // Move wheel to (1.0, 0.0, -2.0)
@@ -385,8 +561,8 @@ int main()
     mywheel3.setRotation(45.0f, glm::vec3(0.0f, 1.0f, 0.0f)); // Rotate 45 degrees around Y-axis
     
 
-    Capsule capsule(texture16);
-    Capsule capsule1(texture16);
+    Capsule capsule(tex("water"));
+    Capsule capsule1(tex("water"));
 
 
     capsule.setPosition(glm::vec3(11.9f, 1.0f, 0.6f));
@@ -399,7 +575,7 @@ int main()
 
 
    
-    HalfSphere halfSphere(texture16, glm::vec3(0.8f), glm::vec3(0.8f), glm::vec3(1.0f), 32.0f);
+    HalfSphere halfSphere(tex("water"), glm::vec3(0.8f), glm::vec3(0.8f), glm::vec3(1.0f), 32.0f);
 
     // configure global opengl state
     // -----------------------------
@@ -410,22 +586,52 @@ int main()
     Shader ourShader("vertexShader.vs", "fragmentShader.fs");
     //Shader lightingShaderWithTexture("vertexShaderForPhongShadingWithTexture.vs", "fragmentShaderForPhongShadingWithTexture.fs");
     Shader lightCubeShader("lightVertexShader.vs", "lightFragmentShader.fs");
+    //lighting pass of deferred shading, one triangle over the screen like the texture packer
+    Shader deferredShader("packVertexShader.vs", "deferredFragmentShader.fs");
+    Shader overdrawShader("packVertexShader.vs", "overdrawFragmentShader.fs");
+    modelLoc = ourShader.uniformLocation("model");
+    materialIndexLoc = ourShader.uniformLocation("materialIndex");
+    //the texture array sits on unit 1, ourTexture keeps unit 0
+    ourShader.use();
+    ourShader.setInt("ourTextureArray", 1);
+    ourShader.setBool("invertInShader", invertNormalsInShader);
+
+    //the directional light lives in one uniform buffer, filled once per frame
+    LightBlock lightBlock;
+    lightBlock.attach(ourShader);
+    //point and spot lights reach the shader through view space clusters
+    LightClusters lightClusters;
+    lightClusters.attach(ourShader);
+    defineMaterials();
+    defineAnimations();
+    materialTable.attach(ourShader);
+    //the lighting pass reads the same lights and materials
+    DeferredRenderer deferredRenderer;
+    deferredShader.use();
+    lightBlock.attach(deferredShader);
+    lightClusters.attach(deferredShader);
+    materialTable.attach(deferredShader);
+    deferredRenderer.attach(deferredShader);
+    OverdrawView overdrawView;
+    overdrawShader.use();
+    overdrawView.attach(overdrawShader);
+    //shadows of the directional light, read by both lighting paths
+    CascadedShadowMap shadowMap;
+    deferredShader.use();
+    shadowMap.attach(deferredShader);
+    ourShader.use();
+    shadowMap.attach(ourShader);
+    //and of the point and spot lights, a few faces a frame
+    ShadowAtlas shadowAtlas;
+    shadowAtlas.setBudget(shadowFacesPerFrame);
+    deferredShader.use();
+    shadowAtlas.attach(deferredShader);
+    ourShader.use();
+    shadowAtlas.attach(ourShader);
     //Shader ourShader2("vertexShader2.vs", "fragmnetShader2.fs");
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     // ------------------------------------------------------------------
-    string diffuseMapPathUni = "glass.jpg";
-    string specularMapPathUni = "glass.jpg";
-
-
-
-
-    unsigned int diffMap = loadTexture(diffuseMapPathUni.c_str(), GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-    unsigned int specMap = loadTexture(specularMapPathUni.c_str(), GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-
-
-    std::cout << "Diffuse Map Path: " << diffuseMapPathUni << std::endl;
-    std::cout << "Specular Map Path: " << specularMapPathUni << std::endl;
 
     //// For axis
     //float axisVertices[] = {
@@ -524,6 +730,8 @@ int main()
         20, 21, 22,
         22, 23, 20
     };
+    for (int i = 0; i < 24; i++)
+        cubeBounds.expand(glm::vec3(cube_vertices[i * 8], cube_vertices[i * 8 + 1], cube_vertices[i * 8 + 2]));
 
     GLfloat roof_points[] = {
    -0.0050, 1.7348, 1.0,
@@ -569,7 +777,7 @@ int main()
     glGenBuffers(1, &cubeVBO);
     glGenBuffers(1, &cubeEBO);
 
-    glBindVertexArray(cubeVAO);
+    bindVertexArray(cubeVAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(cube_vertices), cube_vertices, GL_STATIC_DRAW);
@@ -593,10 +801,14 @@ int main()
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)24);
     glEnableVertexAttribArray(2);
 
+    //per frame the moving objects' cubes go out as instances of this cube
+    CubeCommands cubeCommands(cubeVBO, cubeEBO);
+    cubeQueue = &cubeCommands;
+
     //light's VAO
     unsigned int lightCubeVAO;
     glGenVertexArrays(1, &lightCubeVAO);
-    glBindVertexArray(lightCubeVAO);
+    bindVertexArray(lightCubeVAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
@@ -630,60 +842,143 @@ int main()
 
 
 
-    // Texture loading
-
-    //Texture 0
-    glGenTextures(1, &texture0);
-    glBindTexture(GL_TEXTURE_2D, texture0);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-   
+    //Static scene bake: record every cube that never moves once, then draw them all
+    //from one texture-sorted buffer each frame
+    StaticBatch staticBatch(cube_vertices, cube_indices);
+    ourShader.use();
+    cubeRecorder = &staticBatch;
+    staticBatch.begin();
+    drawStaticScene(ourShader);
+    staticBatch.end();
+    cubeRecorder = NULL;
+    std::cout << "Static batch: " << staticBatch.cubeCount() << " cubes in " << staticBatch.drawCount() << " draws" << std::endl;
 
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load("transparent.png", &width, &height, &nrChannels, 0);
-    if (data)
+    //Patient beds are instances of one recorded pat_bed: the two in the wards plus
+    //40 per stress ward, all in one instanced draw per texture
+    std::vector<BatchInstance> patBeds;
+    patBeds.push_back({ glm::translate(glm::mat4(1.0f), glm::vec3(10.2f, 2.3f, -2.2f)), glm::vec4(1.0f) });
+    patBeds.push_back({ glm::translate(glm::mat4(1.0f), glm::vec3(8.2f, 2.3f, 10.2f)), glm::vec4(1.0f) });
+    for (int ward = 0; ward < stressWards; ward++)
     {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        glm::vec3 wardOrigin = glm::vec3(45.0f + (ward % 5) * 18.0f, -0.2f, -(ward / 5) * 20.0f);
+        for (int bed = 0; bed < 40; bed++)
+        {
+            glm::vec3 position = wardOrigin + glm::vec3((bed % 10) * 1.6f, 0.0f, (bed / 10) * 4.0f);
+            patBeds.push_back({ glm::translate(glm::mat4(1.0f), position), glm::vec4(0.8f, 0.9f, 1.0f, 1.0f) });
+        }
     }
-    else
+    StaticBatch patBedPrototype(cube_vertices, cube_indices);
+    recordPrototype(patBedPrototype, ourShader, pat_bed);
+    patBedPrototype.setInstances(patBeds);
+    float patBedPrototypeAngle = patbedangle;
+    std::cout << "pat_bed prototype: " << patBedPrototype.cubeCount() << " cubes, " << patBedPrototype.instances() << " instances in " << patBedPrototype.drawCount() << " draws" << std::endl;
+
+    //the shadow cascades' depth range takes in the whole static scene and every bed
+    BoundingBox casterBounds = staticBatch.bounds();
+    for (const BatchInstance& bed : patBeds)
+        casterBounds.expand(patBedPrototype.bounds().transformed(bed.model));
+    shadowMap.setCasters(casterBounds);
+    //every bed swings its backrest, each is a mover of the point and spot light shadows
+    std::vector<int> patBedMovers;
+    for (size_t i = 0; i < patBeds.size(); i++)
+        patBedMovers.push_back(shadowAtlas.addMover());
+
+    //Once every image is in, the batches' textures are copied into one texture array
+    //and each batch becomes a single draw
+    TextureArray batchTextures;
+
+    buildHospitalCells(hospitalCells);
+    addWardLights(wardLights, hospitalCells);
+    lightClusters.add(&pointLight, shadowAtlas.add(&pointLight));
+    lightClusters.add(&spotLight, shadowAtlas.add(&spotLight));
+    for (const PointLight& light : wardLights)
+        lightClusters.add(&light, shadowAtlas.add(&light));
+    lightClusters.setShadows(&shadowAtlas.texels());
+
+    //Object space boxes of the props still drawn every frame, measured once. Parts that
+    //slide are measured at both ends of their travel
+    BoundingBox liftBounds = measureObject(ourShader, Lift);
+    liftUpCurrent = 2.35f;
+    liftBounds.expand(measureObject(ourShader, Lift));
+    liftUpCurrent = 0.0f;
+    BoundingBox gateBounds = measureObject(ourShader, entrancegate);
+    gateOpenCurrent = 2.7f;
+    gateBounds.expand(measureObject(ourShader, entrancegate));
+    gateOpenCurrent = 0.0f;
+    BoundingBox mriBedBounds = measureObject(ourShader, mri_bed);
+    BoundingBox xrayBedBounds = measureObject(ourShader, xray_bed);
+    movemribed = -1.5f;
+    mriBedBounds.expand(measureObject(ourShader, mri_bed));
+    xrayBedBounds.expand(measureObject(ourShader, xray_bed));
+    movemribed = 0.0f;
+    BoundingBox xrayDandaBounds = measureObject(ourShader, xray_danda);
+    BoundingBox doorBounds = measureObject(ourShader, door);
+    BoundingBox bedBounds = measureObject(ourShader, [](Shader& shader, glm::mat4 moveMatrix, glm::vec4) { Bed(shader, moveMatrix); });
+
+    //Where those props stand. Only the doors, the sliding bed and the x-ray arm move,
+    //the loop sets what they changed and placements.update() recomposes just those
+    TransformSystem placements;
+    int liftPlacement = placements.add();
+    placements.setTranslation(liftPlacement, glm::vec3(-4.4f, -0.5f, 0.0f));
+    int gatePlacement = placements.add();
+    placements.setTranslation(gatePlacement, glm::vec3(2.95f, -0.4f, 01.5f));
+    int mriPlacement = placements.add();
+    placements.setTranslation(mriPlacement, glm::vec3(11.5f, 0.8f, 7.5f));
+    placements.setScale(mriPlacement, glm::vec3(1.0f, 0.37f, 0.5f));
+    int bedPlacement = placements.add();
+    placements.setScale(bedPlacement, glm::vec3(1.5f, 1.1f, 1.5f));
+    const glm::vec3 doorPositions[] = {
+        glm::vec3(-1.67f + 12.33f, -0.4f, 1.4f + 7.61f),
+        glm::vec3(-1.67f + 12.34f, -0.4f, 1.4f + 5.6f),
+        glm::vec3(4.6f + 9.6f, 2.35f - 0.42f, 1.4f + 7.6f),
+        glm::vec3(4.6f + 9.6f, 2.35f - 0.42f, 1.4f + 0.6f),
+        glm::vec3(-1.6f + 9.6f, 2.35f - 0.42f, 1.4f + 0.6f)
+    };
+    const glm::vec3 doorScales[] = {
+        glm::vec3(0.80f, 1.23f, 1.0f),
+        glm::vec3(0.79f, 1.23f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 1.0f)
+    };
+    const int doorCount = sizeof(doorPositions) / sizeof(doorPositions[0]);
+    int doorPlacements[doorCount];
+    for (int i = 0; i < doorCount; i++)
     {
-        cout << "Failed to load texture 0" << endl;
+        doorPlacements[i] = placements.add();
+        placements.setTranslation(doorPlacements[i], doorPositions[i]);
+        placements.setScale(doorPlacements[i], doorScales[i]);
     }
-    stbi_image_free(data);
-
-
-    load_texture(texture1, "floor2.jpg", GL_RGB, true);
-    load_texture(texture2, "wall3.jpg", GL_RGB, true);
-    load_texture(texture3, "wood.jpg", GL_RGB, true);
-    load_texture(texture8, "curtain.jpg", GL_RGB, true);
-    load_texture(texture4, "carpet.jpg", GL_RGB, true);
-    load_texture(texture5, "concrete1.png", GL_RGBA, true);
-    load_texture(texture6, "stair_upper.jpg", GL_RGB, true);
-    load_texture(texture7, "concrete2.png", GL_RGBA, true);
-    load_texture(texture9, "Wood.jpg", GL_RGB, true);
-    load_texture(texture10, "stick.jpg", GL_RGB, true);
-    load_texture(texture11, "sofa.jpg", GL_RGB, true);
-
-    load_texture(texture12, "wood.jpg", GL_RGB, true);
-    load_texture(texture13, "sky.jpg", GL_RGB, true);
-    load_texture(texture14, "road.jpg", GL_RGB, true);
-    load_texture(texture15, "bed.jpg", GL_RGB, true);
-    load_texture(texture16, "water.jpeg", GL_RGB, true);
-    load_texture(texture17, "wheelchair.jpeg", GL_RGB, true);
-
-    std::cout << "Texture16 ID: " << texture16 << std::endl;
+    int mriBedPlacement = placements.add();
+    placements.setTranslation(mriBedPlacement, glm::vec3(13.4f, 2.3f, 13.2f));
+    placements.setRotation(mriBedPlacement, 90.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+    int xrayBedPlacement = placements.add();
+    placements.setTranslation(xrayBedPlacement, glm::vec3(14.2f, 2.5f, -3.5f));
+    int xrayDandaPlacement = placements.add();
+    //the same parts again for the point and spot light shadows, which are drawn
+    //again only where one moved
+    int liftMover = shadowAtlas.addMover();
+    int gateMover = shadowAtlas.addMover();
+    int mriMover = shadowAtlas.addMover();
+    int cartMover = shadowAtlas.addMover();
+    int doorMovers[doorCount];
+    for (int i = 0; i < doorCount; i++)
+        doorMovers[i] = shadowAtlas.addMover();
+    int mriBedMover = shadowAtlas.addMover();
+    int xrayBedMover = shadowAtlas.addMover();
+    int xrayDandaMover = shadowAtlas.addMover();
+    //the MRI shell scales after rotating, which is no translate * rotate * scale, but it never moves
+    const glm::mat4 mriShellModel = glm::translate(glm::mat4(1.0f), glm::vec3(11.9f, 3.3f, 12.9f))
+        * glm::scale(glm::mat4(1.0f), glm::vec3(1.0f, 0.7f, 1.0f))
+        * glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), glm::vec3(0.0f, 0.6f, 0.0f))
+        * glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
 
    // Sphere2  planet = Sphere2(1.0f, 144, 72, glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.5f, 0.5f, 0.5f), 32.0f, diffMap, specMap, 0.0f, 0.0f, 1.0f, 1.0f);
-    Curve wheel(wheel_vertices, texture1, texture3, 1.0f);
+    Curve wheel(wheel_vertices, tex("floor"), tex("wood"), 1.0f);
 
 
-    BezierCurve roof_design = BezierCurve(roof_points, 16 * 3, texture16);
+    BezierCurve roof_design = BezierCurve(roof_points, 16 * 3, tex("water"));
 
     //BezierSculpt sculpure_design = BezierSculpt(sculp_points, 13 * 3, laughEmoji);
 
@@ -691,7 +986,7 @@ int main()
     bool fine = 0;
     float rail = 0;
 
-    //BezierCurve salinePacket(controlPoints.data(), controlPoints.size(), texture16);
+    //BezierCurve salinePacket(controlPoints.data(), controlPoints.size(), tex("water"));
 
     float temp[] = {
 -1.4700, 0.3500, 5.1000,
@@ -787,30 +1082,35 @@ int main()
 
     Bezier temp2 = Bezier(temp, sizeof(temp) / sizeof(temp[0]), glm::vec3(1.0f, 1.0f, 1.0f));
     Sphere mri_wheel = Sphere(0.15);
-    Cylinder cylinder(texture16);
-    Cylinder cylinder1(texture16);
-    Cylinder cylinder2(texture16);
+    BoundingBox mriBounds;
+    ourShader.use();
+    boundsRecorder = &mriBounds;
+    MRI(ourShader, glm::mat4(1.0f), glm::vec4(1.0f), mri_wheel);
+    boundsRecorder = NULL;
+    Cylinder cylinder(tex("water"));
+    Cylinder cylinder1(tex("water"));
+    Cylinder cylinder2(tex("water"));
 
 
 
-    Cylinder cylinder3(texture16);
+    Cylinder cylinder3(tex("water"));
 
-    Cylinder cylinder4(texture16);
+    Cylinder cylinder4(tex("water"));
 
-    Cylinder cylinder5(texture16);
-   // Cylinder cylinder6(texture16);
+    Cylinder cylinder5(tex("water"));
+   // Cylinder cylinder6(tex("water"));
 
-    Cylinder cylinder6(texture16);
+    Cylinder cylinder6(tex("water"));
 
-    Cylinder cylinder7(texture16);
+    Cylinder cylinder7(tex("water"));
 
-    Cylinder cylinder8(texture16);
+    Cylinder cylinder8(tex("water"));
 
-    Cylinder cylinder9(texture16);
+    Cylinder cylinder9(tex("water"));
 
-    Cylinder cylinder10(texture16);
+    Cylinder cylinder10(tex("water"));
 
-    Cylinder cylinder11(texture16);
+    Cylinder cylinder11(tex("water"));
 
 
     // Set transformations
@@ -887,28 +1187,111 @@ int main()
 
 
     for (int i = 0; i < 5; ++i) {
-        CurvedPipeSegment segment(texture16, pipeRadius, arcLength);
+        CurvedPipeSegment segment(tex("water"), pipeRadius, arcLength);
         segment.setPosition(glm::vec3(11.6f, 0.8f, -i * 1.5f));
-        segments.push_back(segment);
+        segments.push_back(std::move(segment));
     }
+    std::cout << "Primitive meshes: " << PrimitiveMeshRegistry::shared().meshCount() << " shared, " << PrimitiveMeshRegistry::shared().arenaBytes() / 1024 << " KB" << std::endl;
 
 
 
 
     //Bezier fan(fanControlPoints, sizeof(fanControlPoints) / sizeof(fanControlPoints[0]));
+    // benchmark frames are 1/60 s of path time apart however long they take.
+    // The first few stay at the start of the path while buffers are uploaded
+    // and the driver warms up, they are written out but not summarised
+    const float benchmarkStep = 1.0f / 60.0f;
+    const int benchmarkWarmup = 10;
+    int benchmarkFrames = benchmarkPath != NULL ? benchmarkWarmup + (int)(cameraPath.duration() / benchmarkStep) + 1 : 0;
+    BenchmarkLog benchmarkLog;
+    //--overdraw on: fragments per covered pixel, summed over the measured frames
+    double overdrawSum = 0.0;
+    //static shadow layers drawn again over the measured frames
+    int shadowCascadesRedrawn = 0;
+    //point and spot light shadow faces drawn over the measured frames
+    int shadowFacesDrawn = 0;
+    benchmarkLog.warmupFrames = benchmarkWarmup;
+    benchmarkLog.frames.reserve(benchmarkFrames);
+    GpuFrameTimer gpuTimer;
+    if (benchmarkPath != NULL)
+        gpuTimer.create();
+    int frame = 0;
+
+    // a benchmark measures the fully textured scene, otherwise the first
+    // frames go out with placeholders while the images are still decoding
+    if (benchmarkPath != NULL)
+        textureLoader.finish();
+    bool texturesPending = true;
+    bool firstFrame = true;
+
     // render loop
     // -----------
-    while (!glfwWindowShouldClose(window))
+    while (benchmarkPath != NULL ? frame < benchmarkFrames : !glfwWindowShouldClose(window))
     {
         // per-frame time logic
         // --------------------
-        float currentFrame = static_cast<float>(glfwGetTime());
+        float currentFrame = benchmarkPath != NULL ? (frame < benchmarkWarmup ? 0 : frame - benchmarkWarmup) * benchmarkStep : static_cast<float>(glfwGetTime());
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
+        RenderState::current().resetCounters();
+        size_t frameStartAllocations = allocationCount();
+        std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
+        if (texturesPending && !textureLoader.update())
+        {
+            texturesPending = false;
+            textureManager.collect();
+            std::cout << "Fully textured after " << std::chrono::duration<double, std::milli>(frameStart - programStart).count() << " ms ("
+                << textureLoader.threadCount() << " decode threads, " << textureLoader.bakedCount() << " baked, "
+                << textureLoader.textureBytes() / (1024 * 1024) << " MB of textures)" << std::endl;
+
+            std::vector<GLuint> textures;
+            staticBatch.collectTextures(textures);
+            patBedPrototype.collectTextures(textures);
+            batchTextures.pack(textures);
+            staticBatch.useTextureArray(&batchTextures);
+            patBedPrototype.useTextureArray(&batchTextures);
+            std::cout << "Texture array: " << batchTextures.layerCount() << " layers of " << batchTextures.layerSize() << "x" << batchTextures.layerSize()
+                << " (" << batchTextures.bytes() / (1024 * 1024) << " MB), static batch in " << staticBatch.drawCount() << " draws" << std::endl;
+
+            //the array has its full size copies, from here on the streamer may trim the originals
+            if (textureStreamer.textureCount() > 0)
+            {
+                textureStreamer.enable();
+                RenderState::current().setDrawListener(&textureStreamer);
+            }
+        }
 
         // input
         // -----
-        processInput(window, mywheel, mywheel1, mywheel2, mywheel3);
+        if (benchmarkPath != NULL)
+        {
+            gpuTimer.begin(frame);
+            if (vertexStageOnly)
+                glEnable(GL_RASTERIZER_DISCARD);
+            glm::vec3 position;
+            float yaw, pitch;
+            cameraPath.sample(currentFrame, position, yaw, pitch);
+            camera.SetPose(position, yaw, pitch);
+        }
+        else
+            processInput(window);
+        updateEntranceGate();
+        updateMRI();
+        animations.advance(deltaTime);
+        //the cart's wheels are placed again only on frames it moved
+        if (animations.changed(cartAnimation))
+        {
+            wheelX1 = wheelX2 = wheelX3 = wheelX4 = transX1;
+            mywheel.setPosition(glm::vec3(12.66f + wheelX1, -0.3f, -2.94f));
+            mywheel1.setPosition(glm::vec3(12.66f + wheelX2, -0.3f, -2.31f));
+            mywheel2.setPosition(glm::vec3(10.97f + wheelX3, -0.4f, -2.31f));
+            mywheel3.setPosition(glm::vec3(10.97f + wheelX4, -0.4f, -2.93f));
+        }
+
+        //mip levels asked for by last frame's draws, then this frame's camera
+        textureStreamer.update();
+        textureStreamer.beginFrame(camera.Position, SCR_HEIGHT / (2.0f * tanf(glm::radians(camera.Zoom) * 0.5f)));
 
         // render
         // ------
@@ -918,7 +1301,7 @@ int main()
 
         // activate shader
         ourShader.use();
-        glBindVertexArray(cubeVAO);
+        bindVertexArray(cubeVAO);
 
         // pass projection matrix to shader (note that in this case it could change every frame)
         glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
@@ -936,14 +1319,17 @@ int main()
         //glm::mat4 view = basic_camera.createViewMatrix();
         glm::mat4 view = camera.GetViewMatrix();
         ourShader.setMat4("view", view);
+        viewFrustum = Frustum(projection * view);
+        hospitalCells.update(camera.Position, projection * view);
+        cullCounters = CullCounters();
 
 
         //**************lighting**************
 
         /*glm::vec3 lightColor;
-        lightColor.x = sin(glfwGetTime() * 1.0f);
-        lightColor.y = sin(glfwGetTime() * 0.35f);
-        lightColor.z = sin(glfwGetTime() * 0.7f);
+        lightColor.x = sin(currentFrame * 1.0f);
+        lightColor.y = sin(currentFrame * 0.35f);
+        lightColor.z = sin(currentFrame * 0.7f);
         glm::vec3 diffuseColor = lightColor * glm::vec3(0.5f);
         glm::vec3 ambientColor = diffuseColor * glm::vec3(0.2f);
         ourShader.setVec4("light.ambient", glm::vec4(ambientColor, 1.0f));
@@ -954,7 +1340,7 @@ int main()
         lightPositions[0].y = sin(glfwGetTime() / 2.0f) * 1.0f;*/
 
         //Setting up Directional Light
-        directionalLight.setUpLight(ourShader);
+        directionalLight.setUpLight(lightBlock.data.directionalLight);
         if (!directionalLightOn)
             directionalLight.turnOff();
         if (!ambientOn)
@@ -964,8 +1350,7 @@ int main()
         if (!specularOn)
             directionalLight.turnSpecularOff();
 
-        //Setting up Point Light
-        pointLight.setUpLight(ourShader);
+        //Setting up Point Lights, the ward lights follow the same switches
         if (!pointLightOn)
             pointLight.turnOff();
         if (!ambientOn)
@@ -975,8 +1360,15 @@ int main()
         if (!specularOn)
             pointLight.turnSpecularOff();
 
+        for (PointLight& light : wardLights)
+        {
+            if (pointLightOn) light.turnOn(); else light.turnOff();
+            if (ambientOn) light.turnAmbientOn(); else light.turnAmbientOff();
+            if (diffuseOn) light.turnDiffuseOn(); else light.turnDiffuseOff();
+            if (specularOn) light.turnSpecularOn(); else light.turnSpecularOff();
+        }
+
         //Setting up Spot Light
-        spotLight.setUpLight(ourShader);
         if (!spotLightOn)
             spotLight.turnOff();
         if (!ambientOn)
@@ -985,6 +1377,7 @@ int main()
             spotLight.turnDiffuseOff();
         if (!specularOn)
             spotLight.turnSpecularOff();
+        lightBlock.upload();
 
         //Setting up Camera and Others
         ourShader.setVec3("viewPos", camera.Position);
@@ -1009,2146 +1402,2442 @@ int main()
         ////For axis
         //ourShader.use();
         //glm::mat4 identity = glm::mat4(1.0f); // identity matrix
-        //ourShader.setMat4("model", identity);
+        //ourShader.setMat4(modelLoc, identity);
         //glBindVertexArray(axisVAO);
         //glDrawArrays(GL_LINES, 0, 6);use
 
         // Starting
         glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-        glm::mat4 translateMatrix, scaleMatrix, rotateYMatrix, rotateXMatrix;
+        glm::mat4 translateMatrix, scaleMatrix, rotateYMatrix, rotateXMatrix, rotateMatrix, model;
         glm::vec4 color1;
 
-        float chairZ = 0.4f;
-        float fixY = 0.45f;
-        float chairX = 0.1f;
-
-
         //********** Object making ***********
-        //curvewheel
-       /* translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, 2.0f, 5.0f));*/
-
-      
-
-
-        glBindTexture(GL_TEXTURE_2D, texture7);
-
-        //// wall speration
-        glm::mat4  model2, model;
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, -3.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, -3.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, 8.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 8.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 9.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.0f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, 1.90f, 9.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(10.0f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(15.4f, 1.90f, 9.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.5f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 3.90f, 9.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(18.5f, 1.50f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, 8.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 8.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.0f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, 1.90f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(10.0f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(15.4f, 1.90f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.5f, 5.0f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 3.90f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(18.5f, 1.50f, .25f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", color1);
-        ourShader.setVec4("material.diffuse", color1);
-        ourShader.setVec4("material.specular", color1 * 0.5f);
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-
-
-        glActiveTexture(GL_TEXTURE0);
-
-
-        //Ground
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.80f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 1.42f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        Floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-        //entrance_front_wooden part
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.9f, -0.4f, 15.05f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 4.6f, 0.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.7f, -0.4f, 15.05f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 4.6f, 0.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-
-        //front_wooden part
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.9f, 2.00f, 15.05f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(9.35f, 4.6f, 0.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(6.5f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.5f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.5f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.00f, 15.04f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-        ////////////////////////////////////////////////////////////////////
-
-        //outside world
-
-     /*   translateMatrix = glm::translate(identityMatrix, glm::vec3(-20.0f, -1.00f, -20.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(120.0f, 90.0f, 140.0f));
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.8f, 0.92f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.8f, 0.92f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);*/
-
-
-        //outside world
-
-        /*translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.00f, 0.05f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(50.35f, 50.6f, 50.2f));
-        model = translateMatrix * rotateYMatrix * scaleMatrix;
-        ourShader.setMat4("model", model);
-        ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.8f, 0.92f, 0.5f));
-        ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.8f, 0.92f, 0.5f));
-        ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-        ourShader.setFloat("material.shininess", 32.0f);
-        glBindTexture(GL_TEXTURE_2D, texture12);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);*/
-
-        //second_floor
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(4.5f, 1.7f, 2.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.73f, 0.2f, 0.98f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        Floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-
-        //third_floor
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 4.1f, 2.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 1.42f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        Floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-        //fourth_floor
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 8.9f, 2.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.2f, 0.92f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        //Floor(ourShader, translateMatrix* scaleMatrix, color1);
-
-        //Barrier
-        glm::mat4 rotateMatrix;
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 5.8f, 21.3f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 0.1f));
-        rotateMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture1);
-        Floor(ourShader, translateMatrix* rotateMatrix* scaleMatrix, color1);
-       
-
-        //grass_floor
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-9.5f, -1.0f, 2.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.8f, 0.2f, 2.42f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture14);
-        Floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-        glm::mat4 modelMatrixForContainer3 = glm::mat4(1.0f);
-        modelMatrixForContainer3 = glm::mat4(1.0f);
-
-       
-
-
-        // sperate wall
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -2.15f, 9.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glBindTexture(GL_TEXTURE_2D, texture2);
-        sperateWall(ourShader, translateMatrix, color1);
-        //carpet
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, -2.145f, 2.0f));
-        color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
-
-        glBindTexture(GL_TEXTURE_2D, texture4);
-
-        carpet(ourShader, translateMatrix, color1);
-
-
-        //Boundary
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        Boundary(ourShader, translateMatrix, color1);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 4.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Boundary(ourShader, translateMatrix, color1);
-        //lift
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-4.4f, -0.5f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        Lift(ourShader, translateMatrix, color1);
-
-        //entrancegate
-        //lift
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(2.95f, -0.4f, 01.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        entrancegate(ourShader, translateMatrix, color1);
-
-        /* translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
-         color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);*/
-         //Gate(ourShader, translateMatrix, color1);
-         //Fan
-         //Fan1(ourShader, translateMatrix);
-
-
-        //-0.42f, 15.0f
-
-         ///treepot draw left
-
-     
-
-
-       
-
-
-      
-
-
-
-
-
-         ////outside_boundary
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -2.5f, 0.2f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.5f, 0.5f, 2.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        outside_boundary(ourShader, scaleMatrix * translateMatrix, color1);
-
-
-
-        //Guard Room
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
-        //GuardRoom(ourShader, translateMatrix, color1, texture3);
-
-
-        //mri
-        glActiveTexture(GL_TEXTURE0);
-        rotateXMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 0.6f, 0.0f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.9f, 3.3f, 12.9f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.7f, 1.0f));
-        temp2.drawBezier(ourShader, translateMatrix * scaleMatrix * rotateYMatrix * rotateXMatrix);
-        
-
-
-        glBindVertexArray(cubeVAO);
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 0.8f, 7.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.37f, 0.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        MRI(ourShader, translateMatrix * scaleMatrix * rotateYMatrix, color1, mri_wheel);
-
-
-
-        //Shops
-        glBindVertexArray(cubeVAO);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(4.0f, 0.0f, -2.0f));
-        color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
-        //Shop(ourShader, translateMatrix, color1, texture5);
-
-        glm::mat4 reflectionMatrix(1.0f);
-        glm::vec3 normal(1.0f, 0.0f, 0.0f);
-        for (int i = 0; i < 3; i++) {
-            for (int j = 0; j < 3; j++) {
-                reflectionMatrix[i][j] = (i == j) ? 1.0f - 2.0f * normal[i] * normal[j] : -2.0f * normal[i] * normal[j];
+        //with deferred shading everything ourShader draws goes to the G-buffer,
+        //it is lit once the moving parts are drawn too
+        //the overdraw view counts fragments, there is nothing to light
+        bool overdrawFrame = showOverdraw && overdrawView.begin(framebufferWidth, framebufferHeight);
+        bool deferredFrame = !overdrawFrame && deferredShading && deferredRenderer.beginGeometry(framebufferWidth, framebufferHeight);
+        ourShader.setBool("gBufferPass", deferredFrame);
+        ourShader.setBool("overdrawPass", overdrawFrame);
+
+        //the parts that move, then only what changed is recomposed
+        placements.setTranslation(bedPlacement, glm::vec3(10.9f + transX1, 0.23f, -3.0f));
+        for (int i = 0; i < doorCount; i++)
+            placements.setRotation(doorPlacements[i], i == 1 ? angle1 : angle, glm::vec3(0.0f, 1.0f, 0.0f));
+        placements.setTranslation(xrayDandaPlacement, glm::vec3(14.5f, 3.9f + xraypos, -3.5f));
+        placements.update();
+
+        //where they are now for the point and spot light shadows, then the faces
+        //those shadows draw this frame. The lights' shadow texels are ready for
+        //the clusters after that
+        shadowAtlas.place(liftMover, liftBounds.transformed(placements.world(liftPlacement)), animations.changed(liftAnimation));
+        shadowAtlas.place(gateMover, gateBounds.transformed(placements.world(gatePlacement)), animations.changed(gateAnimation));
+        shadowAtlas.place(mriMover, mriBounds.transformed(placements.world(mriPlacement)), animations.changed(mriAnimation));
+        BoundingBox cartBounds = bedBounds.transformed(placements.world(bedPlacement));
+        for (Wheel* wheel : cartWheels)
+            cartBounds.expand(wheel->bounds());
+        shadowAtlas.place(cartMover, cartBounds, animations.changed(cartAnimation));
+        for (int i = 0; i < doorCount; i++)
+            shadowAtlas.place(doorMovers[i], doorBounds.transformed(placements.world(doorPlacements[i])), animations.changed(i == 1 ? door1Animation : doorAnimation));
+        shadowAtlas.place(mriBedMover, mriBedBounds.transformed(placements.world(mriBedPlacement)), animations.changed(mriBedAnimation));
+        shadowAtlas.place(xrayBedMover, xrayBedBounds.transformed(placements.world(xrayBedPlacement)), animations.changed(mriBedAnimation));
+        shadowAtlas.place(xrayDandaMover, xrayDandaBounds.transformed(placements.world(xrayDandaPlacement)), animations.changed(xrayAnimation));
+        for (size_t i = 0; i < patBeds.size(); i++)
+            shadowAtlas.place(patBedMovers[i], patBedPrototype.bounds().transformed(patBeds[i].model), animations.changed(patBedAnimation));
+        if (lightShadows)
+            shadowAtlas.update(viewFrustum, hospitalCells, camera.Position);
+        else
+            shadowAtlas.clear();
+        lightClusters.update(ourShader, view, glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f, framebufferWidth, framebufferHeight);
+
+        //the cubes of everything that moves are queued up to xray_danda and drawn
+        //together, by the passes below and into every shadow cascade
+        auto drawMovingParts = [&]()
+        {
+            bindVertexArray(cubeVAO);
+            cubeCommands.begin();
+
+            //lift
+            //Lift binds no texture of its own and always picked up the boundary wall
+            bindTexture(GL_TEXTURE_2D, tex("wall"));
+            color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+            if (isVisible(liftBounds.transformed(placements.world(liftPlacement))))
+                Lift(ourShader, placements.world(liftPlacement), color1);
+
+            //entrancegate
+            if (isVisible(gateBounds.transformed(placements.world(gatePlacement))))
+                entrancegate(ourShader, placements.world(gatePlacement), color1);
+
+            //mri
+            activeTexture(GL_TEXTURE0);
+            //drawBezier sets material uniforms ourShader does not have, so the
+            //shell is drawn with the material and texture chosen here
+            bindTexture(GL_TEXTURE_2D, tex("transparent"));
+            setMaterial(ourShader, "grey");
+            if (isVisible(temp2.bounds(mriShellModel)))
+                temp2.drawBezier(ourShader, mriShellModel);
+
+            bindVertexArray(cubeVAO);
+            if (isVisible(mriBounds.transformed(placements.world(mriPlacement))))
+                MRI(ourShader, placements.world(mriPlacement), color1, mri_wheel);
+
+            //Right side
+            bindTexture(GL_TEXTURE_2D, tex("transparent"));
+            if (isVisible(bedBounds.transformed(placements.world(bedPlacement))))
+                Bed(ourShader, placements.world(bedPlacement));
+
+            //doors
+            for (int i = 0; i < doorCount; i++)
+                if (isVisible(doorBounds.transformed(placements.world(doorPlacements[i]))))
+                    door(ourShader, placements.world(doorPlacements[i]), color1);
+
+            //pat_bed
+            //every patient bed shares one prototype, re-recorded only when the backrest moves
+            if (patbedangle != patBedPrototypeAngle)
+            {
+                recordPrototype(patBedPrototype, ourShader, pat_bed);
+                patBedPrototypeAngle = patbedangle;
+            }
+            patBedPrototype.draw(ourShader, viewFrustum, *cullCells, cullCounters);
+            bindVertexArray(cubeVAO);
+
+            //mri_bed
+            bindTexture(GL_TEXTURE_2D, tex("transparent"));
+            if (isVisible(mriBedBounds.transformed(placements.world(mriBedPlacement))))
+                mri_bed(ourShader, placements.world(mriBedPlacement), color1);
+
+            //xray_bed
+            bindTexture(GL_TEXTURE_2D, tex("transparent"));
+            if (isVisible(xrayBedBounds.transformed(placements.world(xrayBedPlacement))))
+                xray_bed(ourShader, placements.world(xrayBedPlacement), color1);
+
+            //xray_danda
+            bindTexture(GL_TEXTURE_2D, tex("transparent"));
+            if (isVisible(xrayDandaBounds.transformed(placements.world(xrayDandaPlacement))))
+                xray_danda(ourShader, placements.world(xrayDandaPlacement), color1);
+
+            cubeCommands.submit(ourShader);
+        };
+
+        //the texture streamer only hears about the draws of the shading pass
+        DrawListener* drawListener = RenderState::current().currentDrawListener();
+
+        //directional light shadows: the static layer of every cascade whose window
+        //moved, then the moving parts over a copy of it. Then the point and spot
+        //light shadow faces the atlas scheduled, everything they see drawn into
+        //their tiles. Casters are culled against the cascade or face and no rooms
+        bool shadowFrame = directionalShadows && directionalLightOn != 0.0f;
+        if (shadowFrame || shadowAtlas.scheduledFaces() > 0)
+        {
+            RenderState::current().setDrawListener(NULL);
+            cullCells = &noCells;
+            ourShader.setBool("depthOnly", true);
+            int redrawn = shadowFrame ? shadowMap.update(view, glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, directionalLight.direction) : 0;
+            if (benchmarkPath != NULL && frame >= benchmarkWarmup)
+            {
+                shadowCascadesRedrawn += redrawn;
+                shadowFacesDrawn += shadowAtlas.scheduledFaces();
             }
+            for (int cascade = 0; shadowFrame && cascade < CascadedShadowMap::cascades; cascade++)
+            {
+                viewFrustum = shadowMap.frustum(cascade);
+                ourShader.use();
+                ourShader.setMat4("projection", shadowMap.projection(cascade));
+                ourShader.setMat4("view", shadowMap.view());
+                if (!shadowMap.cached(cascade))
+                {
+                    shadowMap.beginStatic(cascade);
+                    staticBatch.draw(ourShader, viewFrustum, noCells, cullCounters);
+                    shadowMap.end();
+                }
+                shadowMap.beginMoving(cascade);
+                drawMovingParts();
+                //the cart's wheels draw with the position only light cube shader
+                lightCubeShader.use();
+                lightCubeShader.setMat4("projection", shadowMap.projection(cascade));
+                lightCubeShader.setMat4("view", shadowMap.view());
+                for (Wheel* wheel : cartWheels)
+                    if (isVisible(wheel->bounds()))
+                        wheel->draw(lightCubeShader, glm::mat4(1.0f));
+                shadowMap.end();
+            }
+            for (int face = 0; face < shadowAtlas.scheduledFaces(); face++)
+            {
+                viewFrustum = shadowAtlas.frustum(face);
+                ourShader.use();
+                ourShader.setMat4("projection", shadowAtlas.projection(face));
+                ourShader.setMat4("view", shadowAtlas.view(face));
+                shadowAtlas.begin(face);
+                staticBatch.draw(ourShader, viewFrustum, noCells, cullCounters);
+                drawMovingParts();
+                lightCubeShader.use();
+                lightCubeShader.setMat4("projection", shadowAtlas.projection(face));
+                lightCubeShader.setMat4("view", shadowAtlas.view(face));
+                for (Wheel* wheel : cartWheels)
+                    if (isVisible(wheel->bounds()))
+                        wheel->draw(lightCubeShader, glm::mat4(1.0f));
+                shadowAtlas.end();
+            }
+            ourShader.use();
+            ourShader.setBool("depthOnly", false);
+            ourShader.setMat4("projection", projection);
+            ourShader.setMat4("view", view);
+            viewFrustum = Frustum(projection * view);
+            cullCells = &hospitalCells;
+            cullCounters = CullCounters();
+            RenderState::current().setDrawListener(drawListener);
         }
-        glm::mat4 rotationMatrix;
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-26.7f, 0.0f, -0.7f));
-        rotationMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(0.8f, 0.8f, 0.8f, 1.0f);
-        Shop(ourShader, reflectionMatrix * translateMatrix , color1, texture6);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(4.0f, 0.0f, -6.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Shop(ourShader, translateMatrix, color1, texture7);
-
-        //Lamp Posts
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(2.0f, 0.0f, -0.7f));
-        LampPost(ourShader, translateMatrix);
-
-
-
-      
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
-        //drawCube(ourShader, translateMatrix, glm::vec4(1.0f), 0.5f, 32.0f);
-        // 
-        // 
-        //Right side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.9f+transX1, 0.23f, -3.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Bed(ourShader, translateMatrix * scaleMatrix);
-
-       
-
+        shadowMap.setUniforms(ourShader, shadowFrame);
+        shadowAtlas.bind();
+
+        //with the depth pre-pass the opaque scene goes out twice, depth only and
+        //then shaded where its depth is the one that was kept. The stencil lets
+        //only the first fragment at that depth through, so coplanar faces end
+        //up the way GL_LESS leaves them and every pixel is shaded once.
+        //Near things first (F2) makes the depth test reject more without it
+        staticBatch.sortFrontToBack(frontToBack ? &camera.Position : NULL);
+        patBedPrototype.sortFrontToBack(frontToBack ? &camera.Position : NULL);
+        cubeCommands.sortFrontToBack(frontToBack ? &camera.Position : NULL);
+        for (int pass = depthPrepass ? 0 : 1; pass < 2; pass++)
+        {
+            if (pass == 0)
+            {
+                glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+                ourShader.setBool("depthOnly", true);
+                RenderState::current().setDrawListener(NULL);
+            }
+            else if (depthPrepass)
+            {
+                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                ourShader.setBool("depthOnly", false);
+                RenderState::current().setDrawListener(drawListener);
+                glDepthFunc(GL_EQUAL);
+                glDepthMask(GL_FALSE);
+                glClear(GL_STENCIL_BUFFER_BIT);
+                glEnable(GL_STENCIL_TEST);
+                glStencilFunc(GL_EQUAL, 0, 0xFF);
+                glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+                cullCounters = CullCounters();
+            }
 
+            //walls, floors and furniture that never move are baked into staticBatch before the loop
+            staticBatch.draw(ourShader, viewFrustum, hospitalCells, cullCounters);
+            drawMovingParts();
+        }
+        if (depthPrepass)
+        {
+            glDisable(GL_STENCIL_TEST);
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_TRUE);
+        }
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, -1.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
+        if (deferredFrame)
+        {
+            deferredShader.use();
+            deferredShader.setVec3("viewPos", camera.Position);
+            deferredShader.setBool("lightingOn", lightingOn);
+            lightClusters.setUniforms(deferredShader);
+            shadowMap.setUniforms(deferredShader, shadowFrame);
+            deferredRenderer.light();
+        }
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 2.0f, -3.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-       // Fan1(ourShader, translateMatrix);
 
-        //Porda
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.9f, -0.3f, -0.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        porda(ourShader, translateMatrix, color1);
+        ////tamim
+          //glBindTexture(GL_TEXTURE_2D, tex("wall"));
+          //model2 = transform(3, 2, 5, 90, 0, 0, 1, 1, 1);
+          //wheel.draw(lightCubeShader, model2, glm::vec3(1.0f, 1.0f, 1.0f));
 
+        //model2 = transform(3, 2, 5, 90, 0, 0, .5, .5, .5);
+        //wheel.draw(ourShader, model2, glm::vec3(1.0f, 1.0f, 1.0f));
 
-        //Right side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.9f, 0.0f, 1.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Bed(ourShader, translateMatrix * scaleMatrix);
+        //sphere
+        lightCubeShader.use();
+        lightCubeShader.setBool("overdrawPass", overdrawFrame);
+        lightCubeShader.setMat4("projection", projection);
+        glm::mat4 view2 = camera.GetViewMatrix();
+        lightCubeShader.setMat4("view", view2);
 
-        //Sphere mySphere(glm::vec3(0.8f, 0.8f, 0.8f), glm::vec3(0.7f, 0.2f, 0.1f), glm::vec3(0.2f, 0.2f, 0.2f), 32.0f);
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 2.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        //Chair(ourShader, translateMatrix * scaleMatrix);
+        float time = currentFrame;
+        float rotationSpeed = 0.1f;
+        glm::mat4 modelMatrixForContainer2 = glm::mat4(1.0f);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 2.0f, 1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
+         modelMatrixForContainer2 = glm::translate(model, glm::vec3(-0.45f, -0.4f, -2.8f));
+        bindTexture(GL_TEXTURE_2D, tex("wood"));
+        modelMatrixForContainer2 = transforamtion(5.0, .75, 0.0, 0, 5 * time + rotationSpeed, 0, .4, .12, .4);
+         //planet.drawSphereWithTexture(lightCubeShader, modelMatrixForContainer2);
 
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.4f, -0.3f, 3.1f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //porda(ourShader, translateMatrix, color1);
+         if (isVisible(mywheel.bounds()))
+             mywheel.draw(lightCubeShader, glm::mat4(1.0f));
+         if (isVisible(mywheel1.bounds()))
+             mywheel1.draw(lightCubeShader, glm::mat4(1.0f));
+         if (isVisible(mywheel2.bounds()))
+             mywheel2.draw(lightCubeShader, glm::mat4(1.0f));
+         if (isVisible(mywheel3.bounds()))
+             mywheel3.draw(lightCubeShader, glm::mat4(1.0f));
 
-        //door
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.67f + 12.33f, -0.4f, 1.4f + 7.61f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.80f, 1.23f, 1.0f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
 
-        door(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)) * scaleMatrix, color1);
+         
 
+         glm::mat4 modelFan = glm::mat4(1.0f);
+         // Create and update the model matrix
+         modelFan = glm::scale(modelFan, glm::vec3(0.5f, 1.0f, 0.5f)); // Scale
+         modelFan = glm::rotate(modelFan, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)); // Rotate
+         modelFan = glm::translate(modelFan, glm::vec3(0.0f,0.0f,0.0f)); // Translate
 
-        //door
+         // Pass the updated model matrix to the shader
+         
+         lightCubeShader.setMat4("model", model);
+         //fan.drawBezier(lightCubeShader, modelFan);
+         glm::mat4 modelCylinder = glm::mat4(1.0f);
+         if (isVisible(cylinder.bounds()))
+             cylinder.draw(lightCubeShader);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.67f + 12.34f, -0.4f, 1.4f + 5.6f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.79f, 1.23f, 1.0f));
+         if (isVisible(cylinder1.bounds()))
+             cylinder1.draw(lightCubeShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+         if (isVisible(cylinder2.bounds()))
+             cylinder2.draw(lightCubeShader);
 
-        door(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(angle1), glm::vec3(0.0f, 1.0f, 0.0f)) * scaleMatrix, color1);
+         if (isVisible(cylinder3.bounds()))
+             cylinder3.draw(lightCubeShader);
 
+         if (isVisible(cylinder4.bounds()))
+             cylinder4.draw(lightCubeShader);
 
-        //door
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(4.6f + 9.6f, 2.35f - 0.42f, 1.4f + 7.6f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 1.0f));
+         if (isVisible(cylinder5.bounds()))
+             cylinder5.draw(lightCubeShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+         //cylinder6.draw(lightCubeShader);
 
-        door(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)) * scaleMatrix, color1);
 
+         //cylinder7.draw(lightCubeShader);
 
-        //door
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(4.6f + 9.6f, 2.35f - 0.42f, 1.4f + 0.6f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 1.0f));
+         //cylinder8.draw(lightCubeShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+         //cylinder9.draw(lightCubeShader);
 
-        door(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)) * scaleMatrix, color1);
+         //cylinder10.draw(lightCubeShader);
+         //roof_design.drawBezierCurve(lightCubeShader, modelMatrixForContainer3);
 
+         if (isVisible(capsule.bounds()))
+             capsule.draw(lightCubeShader);
 
-        //door
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.6f + 9.6f, 2.35f - 0.42f, 1.4f + 0.6f));
-        rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 1.0f));
+         if (isVisible(capsule1.bounds()))
+             capsule1.draw(lightCubeShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+         glm::mat4 model3 = glm::mat4(1.0f);
+         model3 = glm::translate(model, glm::vec3(1.0f, 0.0f, 0.0f));
+         model3 = glm::scale(model, glm::vec3(6.0f, 1.0f, 6.0f));
 
-        door(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)) * scaleMatrix, color1);
 
 
-        //Right side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.2f, 0.0f, 4.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        //Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 5.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 2.0f, 4.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
+         // Draw the saline packet
+         //salinePacket.drawBezierCurve(lightCubeShader, model3);
 
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.4f, -0.3f, 6.1f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //porda(ourShader, translateMatrix, color1);
+        modelMatrixForContainer2 = transforamtion(5.0, .75, 0.0, 0, 5 * time + rotationSpeed, 0, .4, .12, .4);
+        //planet.drawSphereWithTexture(ourShader, modelMatrixForContainer2);
 
 
 
-        //Right side dorjar por
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.8f, 0.1f, 10.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 11.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.0f, 2.0f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
+        //********* END of Object Making **********
 
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.8f, -0.3f, 9.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        porda(ourShader, translateMatrix, color1);
+        //Lights
+        lightCubeShader.use();
 
 
 
 
+        for (int i = 1; i <= 2; i++)
+        {
 
+            /*glm::vec3 lightColor;
+            lightColor.x = sin(currentFrame * 1.0f);
+            lightColor.y = sin(currentFrame * 0.35f);
+            lightColor.z = sin(currentFrame * 0.7f);
+            glm::vec3 diffuseColor = lightColor * glm::vec3(0.5f);
+            lightCubeShader.setVec4("bodyColor", glm::vec4(diffuseColor, 1.0f));*/
 
+            glm::vec4 bodyColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
 
+            //emissive
+            glm::vec3 val = glm::vec3(0.5f);
+            if (i == 1 and pointLightOn == 0.0)
+                bodyColor = glm::vec4(val, 1.0f);
+            if (i == 2 and spotLightOn == 0.0)
+                bodyColor = glm::vec4(val, 1.0f);
+            /*if (i == 4 and spotLightOn == 0.0)
+                bodyColor = glm::vec4(val, 1.0f);*/
 
 
+            lightCubeShader.setVec4("bodyColor", bodyColor);
+            glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+            lightCubeShader.setMat4("projection", projection);
+            glm::mat4 view = camera.GetViewMatrix();
+            lightCubeShader.setMat4("view", view);
+            glm::mat4 tempModel = glm::mat4(1.0f);
+            tempModel = glm::translate(tempModel, lightPositions[i]);
+            tempModel = glm::scale(tempModel, glm::vec3(0.5f));
+            lightCubeShader.setMat4("model", tempModel);
 
+            if (!isVisible(cubeBounds.transformed(tempModel)))
+                continue;
+            bindVertexArray(lightCubeVAO);
+            drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
+        }
 
-        //left side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.0f, 0.0f, -3.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, -1.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
+        // render boxes
+        //for (unsigned int i = 0; i < 10; i++)
+        //{
+        //    // calculate the model matrix for each object and pass it to shader before drawing
+        //    glm::mat4 model = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
+        //    model = glm::translate(model, cubePositions[i]);
+        //    float angle = 20.0f * i;
+        //    model = glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
+        //    ourShader.setMat4(modelLoc, model);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, -3.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
+        //    glDrawArrays(GL_TRIANGLES, 0, 36);
+        //}
 
-        //Porda
+        if (overdrawFrame)
+        {
+            overdrawShader.use();
+            overdrawView.show();
+        }
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, -0.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        porda(ourShader, translateMatrix, color1);
+        if (firstFrame)
+        {
+            firstFrame = false;
+            glFinish();
+            std::cout << "First frame after " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - programStart).count() << " ms" << std::endl;
+            std::cout << "Material table: " << materialTable.materialCount() << " materials, " << materialTable.nameCount() << " named" << std::endl;
+            std::cout << "Light clusters: " << lightClusters.lightCount() << " point/spot lights, " << lightClusters.activeLights() << " lit, "
+                << lightClusters.indexCount() << " cluster entries" << std::endl;
+            std::cout << "Shadow map: " << CascadedShadowMap::cascades << " cascades of " << CascadedShadowMap::size << "x" << CascadedShadowMap::size
+                << " (" << shadowMap.bytes() / (1024 * 1024) << " MB)" << std::endl;
+            std::cout << "Shadow atlas: " << ShadowAtlas::tileCount << " tiles of " << ShadowAtlas::tileSize << "x" << ShadowAtlas::tileSize
+                << " (" << shadowAtlas.bytes() / (1024 * 1024) << " MB), " << shadowAtlas.shadowedLights() << " of " << shadowAtlas.lightCount()
+                << " lights shadowed, " << shadowAtlas.waitingFaces() << " faces waiting, " << shadowAtlas.facesPerFrame() << " a frame" << std::endl;
+        }
 
+        // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
+        // -------------------------------------------------------------------------------
+        const RenderState::Counters& counters = RenderState::current().frameCounters();
+        if (benchmarkPath != NULL)
+        {
+            if (vertexStageOnly)
+                glDisable(GL_RASTERIZER_DISCARD);
+            gpuTimer.end();
+            glFlush();
+            BenchmarkFrame measured;
+            measured.cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+            measured.drawCalls = counters.drawCalls;
+            measured.triangles = counters.triangles;
+            measured.stateChanges = counters.issued();
+            measured.stateChangesElided = counters.elided();
+            measured.culled = cullCounters.culled;
+            measured.visibleCells = hospitalCells.visibleCells();
+            benchmarkLog.frames.push_back(measured);
+            if (overdrawFrame && frame >= benchmarkWarmup)
+                overdrawSum += overdrawView.average();
+
+            int finished = frame - (GpuFrameTimer::latency - 1);
+            if (finished >= 0)
+                benchmarkLog.frames[finished].gpuMs = gpuTimer.result(finished);
+            frame++;
+            continue;
+        }
 
-        //left side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(19.7f, 1.8f, 1.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        //Bed(ourShader, translateMatrix * scaleMatrix);
+        //visible rooms, culling, state cache and heap counters for this frame, refreshed in the title twice a second
+        if (currentFrame - lastTitleUpdate > 0.5f)
+        {
+            char title[400];
+            snprintf(title, sizeof(title), "Hospital-1907086 | cells %d/%d | culled %d of %d | draw calls %d | heap allocations %d | state calls %d issued, %d elided (uniforms %d/%d, textures %d/%d, VAOs %d/%d, programs %d/%d) | streamed textures %.1f of %.1f MB, %d reduced",
+                hospitalCells.visibleCells(), hospitalCells.cellCount(), cullCounters.culled, cullCounters.tested, counters.drawCalls,
+                (int)(allocationCount() - frameStartAllocations), counters.issued(), counters.elided(),
+                counters.uniformIssued, counters.uniformElided, counters.textureIssued, counters.textureElided,
+                counters.vertexArrayIssued, counters.vertexArrayElided, counters.programIssued, counters.programElided,
+                textureStreamer.bytesResident() / (1024.0 * 1024.0), textureStreamer.bytesFull() / (1024.0 * 1024.0), textureStreamer.texturesReduced());
+            if (overdrawFrame)
+                snprintf(title + strlen(title), sizeof(title) - strlen(title), " | overdraw %.2f", overdrawView.average());
+            if (shadowAtlas.shadowedLights() > 0 || shadowAtlas.waitingFaces() > 0)
+                snprintf(title + strlen(title), sizeof(title) - strlen(title), " | light shadows %d, faces %d drawn, %d waiting",
+                    shadowAtlas.shadowedLights(), shadowAtlas.scheduledFaces(), shadowAtlas.waitingFaces());
+            glfwSetWindowTitle(window, title);
+            lastTitleUpdate = currentFrame;
+        }
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(19.5f, 0.0f, 2.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
-
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, 1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 3.1f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //porda(ourShader, translateMatrix, color1);
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
 
-        //left side
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(19.8f, 0.8f, 4.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        //Bed(ourShader, translateMatrix * scaleMatrix);
+    if (benchmarkPath != NULL)
+    {
+        // the last few frames are still waiting for their GPU time
+        for (int finished = frame - (GpuFrameTimer::latency - 1); finished < frame; finished++)
+            if (finished >= 0)
+                benchmarkLog.frames[finished].gpuMs = gpuTimer.result(finished);
+        gpuTimer.destroy();
+        if (!benchmarkLog.writeCsv(benchmarkCsv))
+            std::cout << "Failed to write " << benchmarkCsv << std::endl;
+        std::cout << (deferredShading ? "Deferred" : "Forward") << " shading" << (depthPrepass ? " after a depth pre-pass" : "")
+            << (frontToBack ? ", front to back" : "") << " at " << framebufferWidth << "x" << framebufferHeight << std::endl;
+        if (directionalShadows && frame > benchmarkWarmup)
+            std::cout << "Shadows: static cascades drawn " << shadowCascadesRedrawn << " times in " << frame - benchmarkWarmup << " frames" << std::endl;
+        if (lightShadows && frame > benchmarkWarmup)
+            std::cout << "Light shadows: " << shadowFacesDrawn << " faces drawn in " << frame - benchmarkWarmup << " frames, at most "
+                << shadowAtlas.facesPerFrame() << " a frame, " << shadowAtlas.shadowedLights() << " lights shadowed at the end" << std::endl;
+        if (showOverdraw && frame > benchmarkWarmup)
+            std::cout << "Overdraw: " << overdrawSum / (frame - benchmarkWarmup) << " fragments per covered pixel" << std::endl;
+        benchmarkLog.printSummary(std::cout);
+    }
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 5.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
+    // optional: de-allocate all resources once they've outlived their purpose:
+    // ------------------------------------------------------------------------
+    deleteVertexArrays(1, &lightCubeVAO);
+    deleteVertexArrays(1, &cubeVAO);
+    glDeleteBuffers(1, &cubeVBO);
+    glDeleteBuffers(1, &cubeEBO);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, 4.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
+    // glfw: terminate, clearing all previously allocated GLFW resources.
+    // ------------------------------------------------------------------
+    textureManager.clear();
+    if (benchmarkPath != NULL)
+        headless.destroy();
+    else
+        glfwTerminate();
+    return 0;
+}
 
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 6.1f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        porda(ourShader, translateMatrix, color1);
+// process all input: query GLFW whether relevant keys are pressed/released this frame and react accordingly
+// ---------------------------------------------------------------------------------------------------------
 
-        //left side dorjar por
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.0f, 0.0f, 10.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        //Bed(ourShader, translateMatrix * scaleMatrix);
+void processInput(GLFWwindow* window)
+{
+    //held keys only say which way the parts go, animations.advance() moves them
+    animations.drive(mriBedAnimation, glfwGetKey(window, GLFW_KEY_EQUAL) == GLFW_PRESS ? 1.0f : 0.0f);  /// Move MRI BED
+    animations.drive(xrayAnimation, glfwGetKey(window, GLFW_KEY_MINUS) == GLFW_PRESS ? 1.0f : 0.0f);    /// Move X-ray arm
+    animations.drive(patBedAnimation, glfwGetKey(window, GLFW_KEY_SEMICOLON) == GLFW_PRESS ? 1.0f : 0.0f); /// Patient bed backrest
+    animations.drive(cartAnimation, glfwGetKey(window, GLFW_KEY_COMMA) == GLFW_PRESS ? 1.0f : 0.0f);    /// Push the bed on wheels
 
-        //table
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 11.5f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
-        Chair(ourShader, translateMatrix * scaleMatrix);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //Gate(ourShader, translateMatrix, color1);
-        //Fan
-        //Fan1(ourShader, translateMatrix);
-        //porda
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 9.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-
-        //baki_floor
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.2f, 0.2f, 12.5f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 1.7f, -3.9f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-
-        baki_floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-        //baki_floor
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.2f, 0.2f, 12.5f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 1.7f, 10.4f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-
-        baki_floor(ourShader, translateMatrix * scaleMatrix, color1);
-
-        //staircase
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.0f, 0.0f, 1.5f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.35f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.6f, 0.7f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.9f, 1.05f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.2f, 1.40f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.5f, 1.75f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.8f, 2.1f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -2.1f, 2.45f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        staircase(ourShader, translateMatrix, color1);
-
-        //slide
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.9f, 0.15f, 1.67f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        slide(ourShader, translateMatrix, color1);
-
-        //danda
+    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, true);
 
+    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {                 //Forward
+        camera.ProcessKeyboard(FORWARD, deltaTime);
+    }
+    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {                 //Backward
+        camera.ProcessKeyboard(BACKWARD, deltaTime);
+    }
+    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) {                 //Left
+        camera.ProcessKeyboard(LEFT, deltaTime);
+    }
+    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {                 //Right
+        camera.ProcessKeyboard(RIGHT, deltaTime);
+    }
+    //Door open-close: 9 swings the doors to 0 degrees, O back to where they started
+    float doorDrive = glfwGetKey(window, GLFW_KEY_9) == GLFW_PRESS ? 1.0f : glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS ? -1.0f : 0.0f;
+    animations.drive(doorAnimation, -doorDrive);
+    animations.drive(door1Animation, doorDrive);
 
+    if (KeyboardInput::shared().pressed(GLFW_KEY_7))                    //Lift up-down
+    {
 
-      
+        isLiftGoingUp ^= true;
 
 
-        /*glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 0.1f, 3.9f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        danda(ourShader, translateMatrix* glm::rotate(identityMatrix, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);*/
+    }
+    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS)                   //Down
+    {
+        /*if (rotateAxis_X) rotateAngle_X -= 0.1;
+        else if (rotateAxis_Y) rotateAngle_Y -= 0.1;
+        else rotateAngle_Z -= 0.1;*/
 
+        camera.ProcessKeyboard(DOWN, deltaTime);
 
-        /*glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-4.5f, 0.1f, 12.8f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        danda(ourShader, translateMatrix, color1);*/
 
-        /*glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-4.5f, 0.1f, 13.8f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        danda(ourShader, translateMatrix, color1);*/
+    }
 
+    if (glfwGetKey(window, GLFW_KEY_J) == GLFW_PRESS)                   //Pitch positive
+    {
+        /*rotateAngle_X += 1;
+        rotateAxis_X = 1.0;
+        rotateAxis_Y = 0.0;
+        rotateAxis_Z = 0.0;*/
+        camera.ProcessYPR(0.0f, 3.0f, 0.0f);
+    }
+    if (glfwGetKey(window, GLFW_KEY_X) == GLFW_PRESS)                   //Pitch negative
+    {
+        /*rotateAngle_X += 1;
+        rotateAxis_X = 1.0;
+        rotateAxis_Y = 0.0;
+        rotateAxis_Z = 0.0;*/
+        camera.ProcessYPR(0.0f, -3.0f, 0.0f);
+    }
+
+    if (glfwGetKey(window, GLFW_KEY_Y) == GLFW_PRESS)                   //Yaw positive
+    {
+        /*rotateAngle_Y += 1;
+        rotateAxis_X = 0.0;
+        rotateAxis_Y = 1.0;
+        rotateAxis_Z = 0.0;*/
+        camera.ProcessYPR(3.0f, 0.0f, 0.0f);
+    }
+    if (glfwGetKey(window, GLFW_KEY_U) == GLFW_PRESS)                   //Yaw negative
+    {
+        /*rotateAngle_Y += 1;
+        rotateAxis_X = 0.0;
+        rotateAxis_Y = 1.0;
+        rotateAxis_Z = 0.0;*/
+        camera.ProcessYPR(-3.0f, 0.0f, 0.0f);
+    }
+
+    if (glfwGetKey(window, GLFW_KEY_Z) == GLFW_PRESS)                   //Roll positive
+    {
+        /*rotateAngle_Z += 0.1;
+        rotateAxis_X = 0.0;
+        rotateAxis_Y = 0.0;
+        rotateAxis_Z = 1.0;*/
+        camera.ProcessYPR(0.0f, 0.0f, 0.5f);
+
+    }
+    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)                   //Roll negative
+    {
+        /*rotateAngle_Z += 0.1;
+        rotateAxis_X = 0.0;
+        rotateAxis_Y = 0.0;
+        rotateAxis_Z = 1.0;*/
+        camera.ProcessYPR(0.0f, 0.0f, -0.5f);
+
+    }
+
+    if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS)
+    {
+        eyeX += 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS)                   //Rotate camera around a look at point
+    {                                                                   //Right
+        /*eyeX -= 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
+        camera.RotateAroundLookAt(2.0f);
+    }
+    if (glfwGetKey(window, GLFW_KEY_K) == GLFW_PRESS)                   //Rotate camera around a look at point
+    {                                                                   //Left
+        /*eyeX -= 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
+        camera.RotateAroundLookAt(-2.0f);
+    }
+
+    if (glfwGetKey(window, GLFW_KEY_T) == GLFW_PRESS)
+    {
+        eyeZ += 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_G))                    //Rotate Fan
+    {
+        /*eyeZ -= 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
+        isRotating ^= true;
+        cout << isRotating << endl;
+        animations.drive(fanAnimation, isRotating ? 1.0f : 0.0f);
+    }
+    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
+    {
+        eyeY += 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)                   //Up
+    {
+        eyeY -= 2.5 * deltaTime;
+        basic_camera.changeEye(eyeX, eyeY, eyeZ);
+
+        camera.ProcessKeyboard(UP, deltaTime);
+
+    }
+
+    //***************Lighting***************
+
+    //if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)                   //Lighting On-Off
+    //{
+    //    lightingOn ^= true;
+    //    cout << lightingOn << endl;
+    //    Sleep(100);
+    //}
+    if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS)                   //Ambient On
+    {
+        ambientOn = 1.0;
+        pointLight.turnAmbientOn();
+        spotLight.turnAmbientOn();
+        directionalLight.turnAmbientOn();
+    }
+    if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS)                   //Ambient Off
+    {
+        ambientOn = 0.0;
+        pointLight.turnAmbientOff();
+        spotLight.turnAmbientOff();
+        directionalLight.turnAmbientOff();
+    }
+
+    if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS)                   //Diffuse On
+    {
+        diffuseOn = 1.0;
+        pointLight.turnDiffuseOn();
+        spotLight.turnDiffuseOn();
+        directionalLight.turnDiffuseOn();
+
+    }
+    if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS)                   //Diffuse Off
+    {
+        diffuseOn = 0.0;
+        pointLight.turnDiffuseOff();
+        spotLight.turnDiffuseOff();
+        directionalLight.turnDiffuseOff();
+    }
+    if (glfwGetKey(window, GLFW_KEY_5) == GLFW_PRESS)                   //Specular On
+    {
+        specularOn = 1.0;
+        pointLight.turnSpecularOn();
+        spotLight.turnSpecularOn();
+        directionalLight.turnSpecularOn();
+    }
+    if (glfwGetKey(window, GLFW_KEY_6) == GLFW_PRESS)                   //Specular Off
+    {
+        specularOn = 0.0;
+        pointLight.turnSpecularOff();
+        spotLight.turnSpecularOff();
+        directionalLight.turnSpecularOff();
+    }
+    if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS)                   //Point Light On
+    {
+        pointLightOn = 1.0;
+        pointLight.turnOn();
+    }
+    if (glfwGetKey(window, GLFW_KEY_V) == GLFW_PRESS)                   //Point Light Off
+    {
+        pointLightOn = 0.0;
+        pointLight.turnOff();
+    }
+    if (glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS)                   //Directional Light On
+    {
+        directionalLightOn = 1.0;
+        directionalLight.turnOn();
+    }
+    if (glfwGetKey(window, GLFW_KEY_N) == GLFW_PRESS)                   //Directional Light Off
+    {
+        directionalLightOn = 0.0;
+        directionalLight.turnOff();
+    }
+    if (glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS)                   //Spot Light On
+    {
+        spotLightOn = 1.0;
+        spotLight.turnOn();
+    }
+    if (glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS)                   //Spot Light Off
+    {
+        spotLightOn = 0.0;
+        spotLight.turnOff();
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_I))                    //Forward/deferred shading
+    {
+        deferredShading ^= true;
+        cout << (deferredShading ? "Deferred" : "Forward") << " shading" << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_F1))                   //Depth pre-pass On-Off
+    {
+        depthPrepass ^= true;
+        cout << "Depth pre-pass " << (depthPrepass ? "on" : "off") << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_F2))                   //Front to back On-Off
+    {
+        frontToBack ^= true;
+        cout << (frontToBack ? "Front to back" : "Code order") << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_F3))                   //Overdraw view On-Off
+    {
+        showOverdraw ^= true;
+        cout << "Overdraw view " << (showOverdraw ? "on" : "off") << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_F4))                   //Directional shadows On-Off
+    {
+        directionalShadows ^= true;
+        cout << "Shadows " << (directionalShadows ? "on" : "off") << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_F5))                   //Point and spot light shadows On-Off
+    {
+        lightShadows ^= true;
+        cout << "Light shadows " << (lightShadows ? "on" : "off") << endl;
+    }
+    if (KeyboardInput::shared().pressed(GLFW_KEY_0))                    //Dark On-Off
+    {
+        dark ^= true;
+        cout << dark << endl;
+    }
+
+
+
+
+
+    //if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS)               //Basic Camera rotate around lookat
+    //{
+    //    //lookAtX += 2.5 * deltaTime;
+    //    //basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+    //    float change = -0.3f;
+    //    float x, y, z;
+    //    x = eyeX * cos(glm::radians(change)) + eyeZ * sin(glm::radians(change));
+    //    y = eyeY;
+    //    z = - eyeX * sin(glm::radians(change)) + eyeZ * cos(glm::radians(change));
+
+    //    eyeX = x, eyeY = y, eyeZ = z;
+    //    basic_camera.changeEye(eyeX, eyeY, eyeZ);
+    //}
+    //if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS)
+    //{
+    //    //lookAtX -= 2.5 * deltaTime;
+    //    //basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+
+    //    float change = 0.3f;
+    //    float x, y, z;
+    //    x = eyeX * cos(glm::radians(change)) + eyeZ * sin(glm::radians(change));
+    //    y = eyeY;
+    //    z = -eyeX * sin(glm::radians(change)) + eyeZ * cos(glm::radians(change));
+
+    //    eyeX = x, eyeY = y, eyeZ = z;
+    //    basic_camera.changeEye(eyeX, eyeY, eyeZ);
+    //}
+    if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS)
+    {
+        lookAtY += 2.5 * deltaTime;
+        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS)
+    {
+        lookAtY -= 2.5 * deltaTime;
+        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_5) == GLFW_PRESS)
+    {
+        lookAtZ += 2.5 * deltaTime;
+        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_6) == GLFW_PRESS)
+    {
+        lookAtZ -= 2.5 * deltaTime;
+        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
+    }
+    if (glfwGetKey(window, GLFW_KEY_7) == GLFW_PRESS)
+    {
+        basic_camera.changeViewUpVector(glm::vec3(1.0f, 0.0f, 0.0f));
+    }
+    if (glfwGetKey(window, GLFW_KEY_8) == GLFW_PRESS)
+    {
+        basic_camera.changeViewUpVector(glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+    if (glfwGetKey(window, GLFW_KEY_9) == GLFW_PRESS)
+    {
+        basic_camera.changeViewUpVector(glm::vec3(0.0f, 0.0f, 1.0f));
+    }
+
+    KeyboardInput::shared().endFrame();
+}
+
+// glfw: whenever the window size changed (by OS or user resize) this callback function executes
+// ---------------------------------------------------------------------------------------------
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    // make sure the viewport matches the new window dimensions; note that width and
+    // height will be significantly larger than specified on retina displays.
+    glViewport(0, 0, width, height);
+    framebufferWidth = width;
+    framebufferHeight = height;
+}
+
+
+// glfw: whenever the mouse moves, this callback is called
+// -------------------------------------------------------
+void mouse_callback(GLFWwindow* window, double xposIn, double yposIn)
+{
+    float xpos = static_cast<float>(xposIn);
+    float ypos = static_cast<float>(yposIn);
+
+    if (firstMouse)
+    {
+        lastX = xpos;
+        lastY = ypos;
+        firstMouse = false;
+    }
+
+    float xoffset = xpos - lastX;
+    float yoffset = lastY - ypos; // reversed since y-coordinates go from bottom to top
+
+    lastX = xpos;
+    lastY = ypos;
+
+    camera.ProcessMouseMovement(xoffset, yoffset);
+}
+
+// glfw: whenever the mouse scroll wheel scrolls, this callback is called
+// ----------------------------------------------------------------------
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+{
+    camera.ProcessMouseScroll(static_cast<float>(yoffset));
+}
+
+// glfw: key presses, for the keys that toggle something once per press
+// ----------------------------------------------------------------------
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    KeyboardInput::shared().keyEvent(key, action);
+}
+
+
+//Texture Loading
+
+void load_texture(const char* name, string image_name, GLenum format, bool repeat)
+{
+    GLenum wrap = repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+    textureManager.acquire(name, image_name, format, { wrap, wrap, GL_LINEAR, GL_LINEAR });
+}
+
+//Everything that never moves. Only called while the static batch is being baked,
+//the cubes it draws end up in staticBatch instead of on screen
+void drawStaticScene(Shader& ourShader)
+{
+    // Starting
+    glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
+    glm::mat4 translateMatrix, scaleMatrix, rotateYMatrix, rotateXMatrix;
+    glm::vec4 color1;
+
+    float chairZ = 0.4f;
+    float fixY = 0.45f;
+    float chairX = 0.1f;
+
+
+    //********** Object making ***********
+    //curvewheel
+   /* translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, 2.0f, 5.0f));*/
+
+  
+
+
+    bindTexture(GL_TEXTURE_2D, tex("concrete2"));
+
+    //// wall speration
+    glm::mat4  model2, model;
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, -3.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
+
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, -3.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
+
+
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, 8.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
+
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 8.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 9.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.0f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, 1.90f, 9.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(10.0f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(15.4f, 1.90f, 9.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.5f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
-        //doc_table
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 0.0f, -2.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        doc_table(ourShader, translateMatrix, color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 3.90f, 9.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(18.5f, 1.50f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
-        
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 0.0f, -3.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //wheelChair(ourShader, translateMatrix, color1);
 
 
-        //reception
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.3f, 1.0f, 1.0f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 0.0f, 4.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        doc_table(ourShader, scaleMatrix * translateMatrix, color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 1.90f, 8.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 8.9f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.25f, 5.0f, 12.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
-        //pat_chair
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 1.90f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.0f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, 1.90f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(10.0f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 2.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(15.4f, 1.90f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.5f, 5.0f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 1.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 3.90f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(18.5f, 1.50f, .25f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, color1, color1, color1 * 0.5f, 32.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    drawCubeElements(ourShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //computer
 
 
 
+    activeTexture(GL_TEXTURE0);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.5f, .4f, 4.8f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //computer(ourShader, translateMatrix, color1);
+    //Ground
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.80f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 1.42f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
+    Floor(ourShader, translateMatrix * scaleMatrix, color1);
 
+    //entrance_front_wooden part
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, .4f, 4.8f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.9f, -0.4f, 15.05f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 4.6f, 0.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "white");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //computer(ourShader, translateMatrix, color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.7f, -0.4f, 15.05f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 4.6f, 0.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "white");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, .4f, 3.0f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //computer(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    //front_wooden part
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.9f, 2.00f, 15.05f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(9.35f, 4.6f, 0.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "white");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(6.5f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, .4f, 1.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // computer(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
 
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 1.9f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 0.0f, 2.77f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        doc_table(ourShader, scaleMatrix * translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
-        //computer
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.5f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.5f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.00f, 15.04f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 4.6f, 0.4f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "black");
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    drawCubeElements(ourShader);
+    ////////////////////////////////////////////////////////////////////
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.4f, 2.9f, 4.5f));
+    //outside world
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //computer(ourShader, glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(0.0f, 1.0f, 0.0f)) * translateMatrix, color1);
+ /*   translateMatrix = glm::translate(identityMatrix, glm::vec3(-20.0f, -1.00f, -20.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(120.0f, 90.0f, 140.0f));
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "skyBlue");
 
-        //pat_chair
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);*/
 
 
+    //outside world
 
+    /*translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.00f, 0.05f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(50.35f, 50.6f, 50.2f));
+    model = translateMatrix * rotateYMatrix * scaleMatrix;
+    ourShader.setMat4(modelLoc, model);
+    setMaterial(ourShader, "skyBlue");
+    glBindTexture(GL_TEXTURE_2D, tex("entranceWood"));
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);*/
+
+    //second_floor
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(4.5f, 1.7f, 2.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.73f, 0.2f, 0.98f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
+    Floor(ourShader, translateMatrix * scaleMatrix, color1);
+
+
+    //third_floor
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 4.1f, 2.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 1.42f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
+    Floor(ourShader, translateMatrix * scaleMatrix, color1);
+
+    //fourth_floor
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 8.9f, 2.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.2f, 0.92f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
+    //Floor(ourShader, translateMatrix* scaleMatrix, color1);
+
+    //Barrier
+    glm::mat4 rotateMatrix;
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 5.8f, 21.3f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.35f, 0.2f, 0.1f));
+    rotateMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
+    Floor(ourShader, translateMatrix* rotateMatrix* scaleMatrix, color1);
+   
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.3f));
+    //grass_floor
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-9.5f, -1.0f, 2.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.8f, 0.2f, 2.42f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("road"));
+    Floor(ourShader, translateMatrix * scaleMatrix, color1);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    glm::mat4 modelMatrixForContainer3 = glm::mat4(1.0f);
+    modelMatrixForContainer3 = glm::mat4(1.0f);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.3f));
+   
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        
+    // sperate wall
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -2.15f, 9.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
+    sperateWall(ourShader, translateMatrix, color1);
+    //carpet
 
-        // //pat_chair single
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.2f, -2.145f, 2.0f));
+    color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
 
+    bindTexture(GL_TEXTURE_2D, tex("carpet"));
 
+    carpet(ourShader, translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.7f, 2.55f, 13.0f));
+    //Boundary
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    Boundary(ourShader, translateMatrix, color1);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 4.0f, 0.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Boundary(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.7f, 2.55f, 12.0f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    /* translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
+     color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);*/
+     //Gate(ourShader, translateMatrix, color1);
+     //Fan
+     //Fan1(ourShader, translateMatrix);
 
 
+    //-0.42f, 15.0f
 
-        ///upper class chair
+     ///treepot draw left
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.3f));
+ 
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.3f));
+   
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+  
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.55f, 5.3f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.0f, 2.55f, 5.3f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+     ////outside_boundary
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -2.5f, 0.2f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.5f, 0.5f, 2.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    outside_boundary(ourShader, scaleMatrix * translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.6f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    //Guard Room
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+    //GuardRoom(ourShader, translateMatrix, color1, tex("wood"));
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.6f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.55f, 5.6f));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    //Shops
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(4.0f, 0.0f, -2.0f));
+    color1 = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+    //Shop(ourShader, translateMatrix, color1, tex("concrete"));
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 2.55f, 5.6f));
+    glm::mat4 reflectionMatrix(1.0f);
+    glm::vec3 normal(1.0f, 0.0f, 0.0f);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            reflectionMatrix[i][j] = (i == j) ? 1.0f - 2.0f * normal[i] * normal[j] : -2.0f * normal[i] * normal[j];
+        }
+    }
+    glm::mat4 rotationMatrix;
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-26.7f, 0.0f, -0.7f));
+    rotationMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(0.8f, 0.8f, 0.8f, 1.0f);
+    Shop(ourShader, reflectionMatrix * translateMatrix , color1, tex("stairs"));
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-       // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(4.0f, 0.0f, -6.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Shop(ourShader, translateMatrix, color1, tex("concrete2"));
 
+    //Lamp Posts
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(2.0f, 0.0f, -0.7f));
+    LampPost(ourShader, translateMatrix);
 
-        //sofa
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-01.8f, -0.5f, 11.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //sofa(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.75f, 2.0f, 04.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+  
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, -0.5f, 5.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
+    //drawCube(ourShader, translateMatrix, glm::vec4(1.0f), 0.5f, 32.0f);
+    // 
+    // 
 
+   
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, -0.5f, 8.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
 
-        //sofa
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, -1.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-01.8f, -0.5f, 8.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        sofa(ourShader, translateMatrix, color1);
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 2.0f, -3.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+   // Fan1(ourShader, translateMatrix);
 
-        //AC_1
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.55f, 3.5f, -1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        AC_1(ourShader, translateMatrix, color1);
+    //Porda
 
-        //AC_1
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 3.5f, -1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        AC_1(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.9f, -0.3f, -0.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    porda(ourShader, translateMatrix, color1);
 
-        //AC_1
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.55f, 3.5f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        AC_1(ourShader, translateMatrix, color1);
 
-        //AC_1
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 3.5f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        AC_1(ourShader, translateMatrix, color1);
+    //Right side
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.9f, 0.0f, 1.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //pat_bed
+    //Sphere mySphere(glm::vec3(0.8f, 0.8f, 0.8f), glm::vec3(0.7f, 0.2f, 0.1f), glm::vec3(0.2f, 0.2f, 0.2f), 32.0f);
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 2.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    //Chair(ourShader, translateMatrix * scaleMatrix);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.5f, 2.0f, 1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
 
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.4f, -0.3f, 3.1f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //porda(ourShader, translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.2f, 2.3f, -2.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_bed(ourShader, translateMatrix, color1);
 
-        //pat_bed single
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.2f, 2.3f, 10.2f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_bed(ourShader, translateMatrix, color1);
+    //Right side
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.2f, 0.0f, 4.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    //Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //mri_bed
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 5.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 2.0f, 4.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
 
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.4f, -0.3f, 6.1f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //porda(ourShader, translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(13.4f, 2.3f, 13.2f));
-        rotateMatrix = glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        mri_bed(ourShader, translateMatrix*rotateMatrix, color1);
 
-        //xray_bed
+    //Right side dorjar por
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.8f, 0.1f, 10.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Bed(ourShader, translateMatrix * scaleMatrix);
 
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 11.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.0f, 2.0f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
 
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.8f, -0.3f, 9.2f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    porda(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(14.2f, 2.5f, -3.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        xray_bed(ourShader, translateMatrix, color1);
 
-        //hospital
 
 
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 4.5f, 22.0f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.0f, 2.0f, 2.1f));
-        color1 = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
-        hospital(ourShader, translateMatrix * scaleMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(2.8f, 2.5f, 30.65f));
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.2f, 1.0f, 1.0f));
-        color1 = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
-        hospital(ourShader, translateMatrix * scaleMatrix, color1);
 
-        //bookself
 
 
 
 
+    //left side
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.0f, 0.0f, -3.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Bed(ourShader, translateMatrix * scaleMatrix);
 
-        //bookself -xray
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, -1.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
 
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, -3.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
 
+    //Porda
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, -0.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    porda(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(17.60f, 2.1f, 12.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        book_self(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    //left side
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(19.7f, 1.8f, 1.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    //Bed(ourShader, translateMatrix * scaleMatrix);
+
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(19.5f, 0.0f, 2.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, 1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 3.1f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //porda(ourShader, translateMatrix, color1);
 
-        //bookself -room
+    //left side
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(19.8f, 0.8f, 4.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    //Bed(ourShader, translateMatrix * scaleMatrix);
+
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 5.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 2.0f, 4.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
+
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 6.1f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    porda(ourShader, translateMatrix, color1);
+
+    //left side dorjar por
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.0f, 0.0f, 10.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    //Bed(ourShader, translateMatrix * scaleMatrix);
+
+    //table
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 11.5f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 1.1f, 1.5f));
+    Chair(ourShader, translateMatrix * scaleMatrix);
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.0f, 0.0f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //Gate(ourShader, translateMatrix, color1);
+    //Fan
+    //Fan1(ourShader, translateMatrix);
+    //porda
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(16.4f, -0.3f, 9.2f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    //baki_floor
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.2f, 0.2f, 12.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 1.7f, -3.9f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    baki_floor(ourShader, translateMatrix * scaleMatrix, color1);
+
+    //baki_floor
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.2f, 0.2f, 12.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 1.7f, 10.4f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    baki_floor(ourShader, translateMatrix * scaleMatrix, color1);
+
+    //staircase
+
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.0f, 0.0f, 1.5f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.35f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.6f, 0.7f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.90f, 2.1f, 12.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        book_self(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.9f, 1.05f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.2f, 1.40f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
-        //xray_danda
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(14.5f, 3.9f + xraypos, -3.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        xray_danda(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.5f, 1.75f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
-        //xray_lathi
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -1.8f, 2.1f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -2.1f, 2.45f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    staircase(ourShader, translateMatrix, color1);
 
+    //slide
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.9f, 0.15f, 1.67f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    slide(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(15.8f, 1.9f, -3.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        xray_lathi(ourShader, translateMatrix, color1);
+    //danda
 
 
-        //pat_lathi
 
+  
 
 
+    /*glBindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-1.9f, 0.1f, 3.9f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    danda(ourShader, translateMatrix* glm::rotate(identityMatrix, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);*/
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 12.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix, color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix, color1);
+    /*glBindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-4.5f, 0.1f, 12.8f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    danda(ourShader, translateMatrix, color1);*/
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix, color1);
+    /*glBindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-4.5f, 0.1f, 13.8f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    danda(ourShader, translateMatrix, color1);*/
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 12.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 0.45f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 11.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix * scaleMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 0.45f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 11.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pat_lathi(ourShader, translateMatrix * scaleMatrix, color1);
-        //stool - mri
 
 
+    //doc_table
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 0.0f, -2.2f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    doc_table(ourShader, translateMatrix, color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(12.5f, 2.05f, -1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //stool(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 0.0f, -3.2f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //wheelChair(ourShader, translateMatrix, color1);
 
-        //stool - xray
 
+    //reception
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.3f, 1.0f, 1.0f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.5f, 0.0f, 4.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    doc_table(ourShader, scaleMatrix * translateMatrix, color1);
 
 
 
 
+    //pat_chair
 
-        //stool - single
 
 
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 2.5f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-       
-        //sign_board
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 1.5f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    //computer
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        scaleMatrix = glm::scale(identityMatrix, glm::vec3(17.0f, 2.3f, 2.45f));
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(-8.5f, 2.2f, 30.5f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        sign_board(ourShader, translateMatrix * scaleMatrix, color1);
 
-        //ambulance
-        glBindTexture(GL_TEXTURE_2D, texture0);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.5f, .4f, 4.8f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //computer(ourShader, translateMatrix, color1);
 
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, .4f, 4.8f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //computer(ourShader, translateMatrix, color1);
 
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //ambulance(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f + ambx), glm::vec3(0, 1.0f, 0)), color1, mri_wheel);
 
-        //ambulance
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, .4f, 3.0f));
 
-        
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //computer(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 13.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //ambulance(ourShader, translateMatrix, color1, mri_wheel);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, .4f, 1.5f));
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // computer(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(6.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
 
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 1.9f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, 0.0f, 2.77f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    doc_table(ourShader, scaleMatrix * translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
+    //computer
 
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(12.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
 
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(15.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.4f, 2.9f, 4.5f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //computer(ourShader, glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(0.0f, 1.0f, 0.0f)) * translateMatrix, color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(18.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //line_strip(ourShader, translateMatrix, color1);
+    //pat_chair
 
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix, color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 25.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.3f));
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 20.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 15.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.3f));
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 10.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //line_strip
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 5.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    
 
-        //ambulance
+    // //pat_chair single
 
 
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 8.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        // ambulance(ourShader, translateMatrix, color1, mri_wheel);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.7f, 2.55f, 13.0f));
 
-         //ambulance
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.7f, 2.55f, 12.0f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 3.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        //ambulance(ourShader, translateMatrix, color1, mri_wheel);
 
-        //ambulance
+    ///upper class chair
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.3f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.3f));
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, -2.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.55f, 5.3f));
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.0f, 2.55f, 5.3f));
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(15.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(20.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.0f, 2.55f, 5.6f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 21.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 2.55f, 5.6f));
 
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 16.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 11.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 2.55f, 5.6f));
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 6.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 1.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, 2.55f, 5.6f));
 
-        //pillers
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, -4.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        pillers(ourShader, translateMatrix, color1);
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+   // pat_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //glass_window
 
+    //sofa
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-01.8f, -0.5f, 11.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //sofa(ourShader, translateMatrix, color1);
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.75f, 2.0f, 04.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        glBindTexture(GL_TEXTURE_2D, texture0);
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        glass_window(ourShader, translateMatrix, color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, -0.5f, 5.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-        //doc_chair
-        glBindTexture(GL_TEXTURE_2D, texture0);
 
-        translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, -3.3f));
-        color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        doc_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, -0.5f, 8.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    sofa(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
 
-        ////tamim
-          //glBindTexture(GL_TEXTURE_2D, texture2);
-          //model2 = transform(3, 2, 5, 90, 0, 0, 1, 1, 1);
-          //wheel.draw(lightCubeShader, model2, glm::vec3(1.0f, 1.0f, 1.0f));
+    //sofa
 
-        //model2 = transform(3, 2, 5, 90, 0, 0, .5, .5, .5);
-        //wheel.draw(ourShader, model2, glm::vec3(1.0f, 1.0f, 1.0f));
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-01.8f, -0.5f, 8.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    sofa(ourShader, translateMatrix, color1);
 
-        //sphere
-        lightCubeShader.use();
-        lightCubeShader.setMat4("projection", projection);
-        glm::mat4 view2 = camera.GetViewMatrix();
-        lightCubeShader.setMat4("view", view2);
+    //AC_1
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.55f, 3.5f, -1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    AC_1(ourShader, translateMatrix, color1);
 
-        float time = glfwGetTime();
-        float rotationSpeed = 0.1f;
-        glm::mat4 modelMatrixForContainer2 = glm::mat4(1.0f);
+    //AC_1
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 3.5f, -1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    AC_1(ourShader, translateMatrix, color1);
 
-         modelMatrixForContainer2 = glm::translate(model, glm::vec3(-0.45f, -0.4f, -2.8f));
-        glBindTexture(GL_TEXTURE_2D, texture3);
-        modelMatrixForContainer2 = transforamtion(5.0, .75, 0.0, 0, 5 * time + rotationSpeed, 0, .4, .12, .4);
-         //planet.drawSphereWithTexture(lightCubeShader, modelMatrixForContainer2);
+    //AC_1
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.55f, 3.5f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    AC_1(ourShader, translateMatrix, color1);
 
-         mywheel.draw(lightCubeShader,glm::mat4(1.0f));
-         mywheel1.draw(lightCubeShader, glm::mat4(1.0f));
-         mywheel2.draw(lightCubeShader, glm::mat4(1.0f));
-         mywheel3.draw(lightCubeShader, glm::mat4(1.0f));
+    //AC_1
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(11.6f, 3.5f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    AC_1(ourShader, translateMatrix, color1);
 
 
+    //hospital
 
-         
 
-         glm::mat4 modelFan = glm::mat4(1.0f);
-         // Create and update the model matrix
-         modelFan = glm::scale(modelFan, glm::vec3(0.5f, 1.0f, 0.5f)); // Scale
-         modelFan = glm::rotate(modelFan, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)); // Rotate
-         modelFan = glm::translate(modelFan, glm::vec3(0.0f,0.0f,0.0f)); // Translate
 
-         // Pass the updated model matrix to the shader
-         
-         lightCubeShader.setMat4("model", model);
-         //fan.drawBezier(lightCubeShader, modelFan);
-         glm::mat4 modelCylinder = glm::mat4(1.0f);
-         cylinder.draw(lightCubeShader);
 
-         cylinder1.draw(lightCubeShader);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 4.5f, 22.0f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.0f, 2.0f, 2.1f));
+    color1 = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    hospital(ourShader, translateMatrix * scaleMatrix, color1);
 
-         cylinder2.draw(lightCubeShader);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(2.8f, 2.5f, 30.65f));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.2f, 1.0f, 1.0f));
+    color1 = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    hospital(ourShader, translateMatrix * scaleMatrix, color1);
 
-         cylinder3.draw(lightCubeShader);
+    //bookself
 
-         cylinder4.draw(lightCubeShader);
 
-         cylinder5.draw(lightCubeShader);
 
-         //cylinder6.draw(lightCubeShader);
 
 
-         //cylinder7.draw(lightCubeShader);
+    //bookself -xray
 
-         //cylinder8.draw(lightCubeShader);
 
-         //cylinder9.draw(lightCubeShader);
 
-         //cylinder10.draw(lightCubeShader);
-         //roof_design.drawBezierCurve(lightCubeShader, modelMatrixForContainer3);
 
-         capsule.draw(lightCubeShader);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(17.60f, 2.1f, 12.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    book_self(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-         capsule1.draw(lightCubeShader);
 
-         glm::mat4 model3 = glm::mat4(1.0f);
-         model3 = glm::translate(model, glm::vec3(1.0f, 0.0f, 0.0f));
-         model3 = glm::scale(model, glm::vec3(6.0f, 1.0f, 6.0f));
+    //bookself -room
 
 
-         std::vector<CurvedPipeSegment> segments;
-         float pipeRadius = 0.2f;
-         float arcLength = PI / 6.0f;
 
 
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.90f, 2.1f, 12.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    book_self(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
-         // Draw the saline packet
-         //salinePacket.drawBezierCurve(lightCubeShader, model3);
 
-        modelMatrixForContainer2 = transforamtion(5.0, .75, 0.0, 0, 5 * time + rotationSpeed, 0, .4, .12, .4);
-        //planet.drawSphereWithTexture(ourShader, modelMatrixForContainer2);
 
+    //xray_lathi
 
 
 
 
-        //********* END of Object Making **********
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(15.8f, 1.9f, -3.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    xray_lathi(ourShader, translateMatrix, color1);
 
-        //Lights
-        lightCubeShader.use();
 
+    //pat_lathi
 
 
 
-        for (int i = 1; i <= 2; i++)
-        {
 
-            /*glm::vec3 lightColor;
-            lightColor.x = sin(glfwGetTime() * 1.0f);
-            lightColor.y = sin(glfwGetTime() * 0.35f);
-            lightColor.z = sin(glfwGetTime() * 0.7f);
-            glm::vec3 diffuseColor = lightColor * glm::vec3(0.5f);
-            lightCubeShader.setVec4("bodyColor", glm::vec4(diffuseColor, 1.0f));*/
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 12.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix, color1);
 
-            glm::vec4 bodyColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix, color1);
 
-            //emissive
-            glm::vec3 val = glm::vec3(0.5f);
-            if (i == 1 and pointLightOn == 0.0)
-                bodyColor = glm::vec4(val, 1.0f);
-            if (i == 2 and spotLightOn == 0.0)
-                bodyColor = glm::vec4(val, 1.0f);
-            /*if (i == 4 and spotLightOn == 0.0)
-                bodyColor = glm::vec4(val, 1.0f);*/
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix, color1);
 
 
-            lightCubeShader.setVec4("bodyColor", bodyColor);
-            glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-            lightCubeShader.setMat4("projection", projection);
-            glm::mat4 view = camera.GetViewMatrix();
-            lightCubeShader.setMat4("view", view);
-            glm::mat4 tempModel = glm::mat4(1.0f);
-            tempModel = glm::translate(tempModel, lightPositions[i]);
-            tempModel = glm::scale(tempModel, glm::vec3(0.5f));
-            lightCubeShader.setMat4("model", tempModel);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 12.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix, color1);
 
-            glBindVertexArray(lightCubeVAO);
-            glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-        }
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 0.45f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(8.95f, 2.7f, 11.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix * scaleMatrix, color1);
 
 
-        // render boxes
-        //for (unsigned int i = 0; i < 10; i++)
-        //{
-        //    // calculate the model matrix for each object and pass it to shader before drawing
-        //    glm::mat4 model = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-        //    model = glm::translate(model, cubePositions[i]);
-        //    float angle = 20.0f * i;
-        //    model = glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
-        //    ourShader.setMat4("model", model);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 1.0f, 0.45f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(7.95f, 2.7f, 11.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pat_lathi(ourShader, translateMatrix * scaleMatrix, color1);
+    //stool - mri
 
-        //    glDrawArrays(GL_TRIANGLES, 0, 36);
-        //}
 
-        // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-        // -------------------------------------------------------------------------------
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
 
-    // optional: de-allocate all resources once they've outlived their purpose:
-    // ------------------------------------------------------------------------
-    glDeleteVertexArrays(1, &lightCubeVAO);
-    glDeleteVertexArrays(1, &cubeVAO);
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteBuffers(1, &cubeEBO);
 
-    // glfw: terminate, clearing all previously allocated GLFW resources.
-    // ------------------------------------------------------------------
-    glfwTerminate();
-    return 0;
-}
 
-// process all input: query GLFW whether relevant keys are pressed/released this frame and react accordingly
-// ---------------------------------------------------------------------------------------------------------
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(12.5f, 2.05f, -1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //stool(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 
+    //stool - xray
 
-float sign = 1, movemribed = 0;
-float sign2 = 1, patbedangle = 0;
 
-void processInput(GLFWwindow* window, Wheel& mywheel, Wheel& mywheel1,Wheel& mywheel2, Wheel& mywheel3)
-{
 
-    if (glfwGetKey(window, GLFW_KEY_EQUAL) == GLFW_PRESS) /// Move MRI BED
-    {
-        movemribed += sign * 0.01;
 
-        if (movemribed > 0)
-            sign *= -1;
-        if (movemribed < -1.5)
-            sign *= -1;
 
-    }
 
-    if (glfwGetKey(window, GLFW_KEY_MINUS) == GLFW_PRESS) /// Move MRI BED
-    {
-        xraypos += signxray * 0.01;
+    //stool - single
 
-        if (xraypos > .3)
-            signxray *= -1;
-        if (xraypos < -.5)
-            signxray *= -1;
 
-    }
 
 
-    if (glfwGetKey(window, GLFW_KEY_SEMICOLON) == GLFW_PRESS) /// Move MRI BED
-    {
-        patbedangle += 1 * sign2;
 
-        if (patbedangle >= 45)
-            sign2 *= -1;
-        if (patbedangle <= 0)
-            sign2 *= -1;
+   
+    //sign_board
 
-    }
 
-    if (glfwGetKey(window, GLFW_KEY_COMMA) == GLFW_PRESS) 
-    {
-        transX1 += 0.01;
-        wheelX1 += 0.01;
-        wheelX2 += 0.01;
-        wheelX3 += 0.01;
-        wheelX4 += 0.01;
-        mywheel.setPosition(glm::vec3(12.66f + wheelX1, -0.3f, -2.94f));
-        mywheel1.setPosition(glm::vec3(12.66f + wheelX2, -0.3f, -2.31f));
-        mywheel2.setPosition(glm::vec3(10.97f + wheelX3, -0.4f, -2.31f)); 
-        mywheel3.setPosition(glm::vec3(10.97f + wheelX4, -0.4f, -2.93f));
-        cout << wheelX1 << endl;
-    }
 
 
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-        glfwSetWindowShouldClose(window, true);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    scaleMatrix = glm::scale(identityMatrix, glm::vec3(17.0f, 2.3f, 2.45f));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(-8.5f, 2.2f, 30.5f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    sign_board(ourShader, translateMatrix * scaleMatrix, color1);
 
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {                 //Forward
-        camera.ProcessKeyboard(FORWARD, deltaTime);
-    }
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {                 //Backward
-        camera.ProcessKeyboard(BACKWARD, deltaTime);
-    }
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) {                 //Left
-        camera.ProcessKeyboard(LEFT, deltaTime);
-    }
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {                 //Right
-        camera.ProcessKeyboard(RIGHT, deltaTime);
-    }
-    if (glfwGetKey(window, GLFW_KEY_9) == GLFW_PRESS)                   //Door open-close
-    {
-        angle -= 1;
-        angle = min(angle, 90);
-        angle1 += 1;
-        angle1 = min(angle1, 00);
+    //ambulance
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
 
-    }
-    if (glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS)                   //Door open-close
-    {
-        angle += 1;
-        angle = min(angle, 00);
 
-    }
 
-    if (glfwGetKey(window, GLFW_KEY_7) == GLFW_PRESS)                   //Door open-close
-    {
 
-        isLiftGoingUp ^= true;
 
 
-    }
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS)                   //Down
-    {
-        /*if (rotateAxis_X) rotateAngle_X -= 0.1;
-        else if (rotateAxis_Y) rotateAngle_Y -= 0.1;
-        else rotateAngle_Z -= 0.1;*/
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //ambulance(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(0.0f + ambx), glm::vec3(0, 1.0f, 0)), color1, mri_wheel);
 
-        camera.ProcessKeyboard(DOWN, deltaTime);
+    //ambulance
 
+    
 
-    }
 
-    if (glfwGetKey(window, GLFW_KEY_J) == GLFW_PRESS)                   //Pitch positive
-    {
-        /*rotateAngle_X += 1;
-        rotateAxis_X = 1.0;
-        rotateAxis_Y = 0.0;
-        rotateAxis_Z = 0.0;*/
-        camera.ProcessYPR(0.0f, 3.0f, 0.0f);
-    }
-    if (glfwGetKey(window, GLFW_KEY_X) == GLFW_PRESS)                   //Pitch negative
-    {
-        /*rotateAngle_X += 1;
-        rotateAxis_X = 1.0;
-        rotateAxis_Y = 0.0;
-        rotateAxis_Z = 0.0;*/
-        camera.ProcessYPR(0.0f, -3.0f, 0.0f);
-    }
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 13.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //ambulance(ourShader, translateMatrix, color1, mri_wheel);
 
-    if (glfwGetKey(window, GLFW_KEY_Y) == GLFW_PRESS)                   //Yaw positive
-    {
-        /*rotateAngle_Y += 1;
-        rotateAxis_X = 0.0;
-        rotateAxis_Y = 1.0;
-        rotateAxis_Z = 0.0;*/
-        camera.ProcessYPR(3.0f, 0.0f, 0.0f);
-    }
-    if (glfwGetKey(window, GLFW_KEY_U) == GLFW_PRESS)                   //Yaw negative
-    {
-        /*rotateAngle_Y += 1;
-        rotateAxis_X = 0.0;
-        rotateAxis_Y = 1.0;
-        rotateAxis_Z = 0.0;*/
-        camera.ProcessYPR(-3.0f, 0.0f, 0.0f);
-    }
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(3.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
 
-    if (glfwGetKey(window, GLFW_KEY_Z) == GLFW_PRESS)                   //Roll positive
-    {
-        /*rotateAngle_Z += 0.1;
-        rotateAxis_X = 0.0;
-        rotateAxis_Y = 0.0;
-        rotateAxis_Z = 1.0;*/
-        camera.ProcessYPR(0.0f, 0.0f, 0.5f);
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(6.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
 
-    }
-    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)                   //Roll negative
-    {
-        /*rotateAngle_Z += 0.1;
-        rotateAxis_X = 0.0;
-        rotateAxis_Y = 0.0;
-        rotateAxis_Z = 1.0;*/
-        camera.ProcessYPR(0.0f, 0.0f, -0.5f);
 
-    }
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
 
-    if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS)
-    {
-        eyeX += 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS)                   //Rotate camera around a look at point
-    {                                                                   //Right
-        /*eyeX -= 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
-        camera.RotateAroundLookAt(2.0f);
-    }
-    if (glfwGetKey(window, GLFW_KEY_K) == GLFW_PRESS)                   //Rotate camera around a look at point
-    {                                                                   //Left
-        /*eyeX -= 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
-        camera.RotateAroundLookAt(-2.0f);
-    }
 
-    if (glfwGetKey(window, GLFW_KEY_T) == GLFW_PRESS)
-    {
-        eyeZ += 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_G) == GLFW_PRESS)                   //Rotate Fan
-    {
-        /*eyeZ -= 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);*/
-        isRotating ^= true;
-        cout << isRotating << endl;
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(12.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
+
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(15.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
+
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(18.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //line_strip(ourShader, translateMatrix, color1);
+
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix, color1);
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 25.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix, color1);
+
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 20.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 15.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 10.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+
+    //line_strip
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(30.0f, 0.0f, 5.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    line_strip(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
+
+    //ambulance
+
+
+
+
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 8.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    // ambulance(ourShader, translateMatrix, color1, mri_wheel);
+
+     //ambulance
+
+
+
+
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, 3.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    //ambulance(ourShader, translateMatrix, color1, mri_wheel);
+
+    //ambulance
 
-        Sleep(100);
-    }
-    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
-    {
-        eyeY += 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)                   //Up
-    {
-        eyeY -= 2.5 * deltaTime;
-        basic_camera.changeEye(eyeX, eyeY, eyeZ);
 
-        camera.ProcessKeyboard(UP, deltaTime);
 
-    }
 
-    //***************Lighting***************
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(21.0f, 0.0f, -2.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
 
-    //if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS)                   //Lighting On-Off
-    //{
-    //    lightingOn ^= true;
-    //    cout << lightingOn << endl;
-    //    Sleep(100);
-    //}
-    if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS)                   //Ambient On
-    {
-        ambientOn = 1.0;
-        pointLight.turnAmbientOn();
-        spotLight.turnAmbientOn();
-        directionalLight.turnAmbientOn();
-    }
-    if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS)                   //Ambient Off
-    {
-        ambientOn = 0.0;
-        pointLight.turnAmbientOff();
-        spotLight.turnAmbientOff();
-        directionalLight.turnAmbientOff();
-    }
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
 
-    if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS)                   //Diffuse On
-    {
-        diffuseOn = 1.0;
-        pointLight.turnDiffuseOn();
-        spotLight.turnDiffuseOn();
-        directionalLight.turnDiffuseOn();
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
 
-    }
-    if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS)                   //Diffuse Off
-    {
-        diffuseOn = 0.0;
-        pointLight.turnDiffuseOff();
-        spotLight.turnDiffuseOff();
-        directionalLight.turnDiffuseOff();
-    }
-    if (glfwGetKey(window, GLFW_KEY_5) == GLFW_PRESS)                   //Specular On
-    {
-        specularOn = 1.0;
-        pointLight.turnSpecularOn();
-        spotLight.turnSpecularOn();
-        directionalLight.turnSpecularOn();
-    }
-    if (glfwGetKey(window, GLFW_KEY_6) == GLFW_PRESS)                   //Specular Off
-    {
-        specularOn = 0.0;
-        pointLight.turnSpecularOff();
-        spotLight.turnSpecularOff();
-        directionalLight.turnSpecularOff();
-    }
-    if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS)                   //Point Light On
-    {
-        pointLightOn = 1.0;
-        pointLight.turnOn();
-    }
-    if (glfwGetKey(window, GLFW_KEY_V) == GLFW_PRESS)                   //Point Light Off
-    {
-        pointLightOn = 0.0;
-        pointLight.turnOff();
-    }
-    if (glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS)                   //Directional Light On
-    {
-        directionalLightOn = 1.0;
-        directionalLight.turnOn();
-    }
-    if (glfwGetKey(window, GLFW_KEY_N) == GLFW_PRESS)                   //Directional Light Off
-    {
-        directionalLightOn = 0.0;
-        directionalLight.turnOff();
-    }
-    if (glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS)                   //Spot Light On
-    {
-        spotLightOn = 1.0;
-        spotLight.turnOn();
-    }
-    if (glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS)                   //Spot Light Off
-    {
-        spotLightOn = 0.0;
-        spotLight.turnOff();
-    }
-    if (glfwGetKey(window, GLFW_KEY_0) == GLFW_PRESS)                   //Dark On-Off
-    {
-        dark ^= true;
-        cout << dark << endl;
-        Sleep(100);
-    }
 
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(10.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
 
 
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(15.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
 
 
-    //if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS)               //Basic Camera rotate around lookat
-    //{
-    //    //lookAtX += 2.5 * deltaTime;
-    //    //basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
-    //    float change = -0.3f;
-    //    float x, y, z;
-    //    x = eyeX * cos(glm::radians(change)) + eyeZ * sin(glm::radians(change));
-    //    y = eyeY;
-    //    z = - eyeX * sin(glm::radians(change)) + eyeZ * cos(glm::radians(change));
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(20.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
 
-    //    eyeX = x, eyeY = y, eyeZ = z;
-    //    basic_camera.changeEye(eyeX, eyeY, eyeZ);
-    //}
-    //if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS)
-    //{
-    //    //lookAtX -= 2.5 * deltaTime;
-    //    //basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
 
-    //    float change = 0.3f;
-    //    float x, y, z;
-    //    x = eyeX * cos(glm::radians(change)) + eyeZ * sin(glm::radians(change));
-    //    y = eyeY;
-    //    z = -eyeX * sin(glm::radians(change)) + eyeZ * cos(glm::radians(change));
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 21.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 16.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 11.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 6.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, 1.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+    //pillers
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(24.0f, 0.0f, -4.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    pillers(ourShader, translateMatrix, color1);
+
+    //glass_window
 
-    //    eyeX = x, eyeY = y, eyeZ = z;
-    //    basic_camera.changeEye(eyeX, eyeY, eyeZ);
-    //}
-    if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS)
-    {
-        lookAtY += 2.5 * deltaTime;
-        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS)
-    {
-        lookAtY -= 2.5 * deltaTime;
-        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_5) == GLFW_PRESS)
-    {
-        lookAtZ += 2.5 * deltaTime;
-        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_6) == GLFW_PRESS)
-    {
-        lookAtZ -= 2.5 * deltaTime;
-        basic_camera.changeLookAt(lookAtX, lookAtY, lookAtZ);
-    }
-    if (glfwGetKey(window, GLFW_KEY_7) == GLFW_PRESS)
-    {
-        basic_camera.changeViewUpVector(glm::vec3(1.0f, 0.0f, 0.0f));
-    }
-    if (glfwGetKey(window, GLFW_KEY_8) == GLFW_PRESS)
-    {
-        basic_camera.changeViewUpVector(glm::vec3(0.0f, 1.0f, 0.0f));
-    }
-    if (glfwGetKey(window, GLFW_KEY_9) == GLFW_PRESS)
-    {
-        basic_camera.changeViewUpVector(glm::vec3(0.0f, 0.0f, 1.0f));
-    }
 
+
+
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    glass_window(ourShader, translateMatrix, color1);
+
+    //doc_chair
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
+
+    translateMatrix = glm::translate(identityMatrix, glm::vec3(9.0f, 0.0f, -3.3f));
+    color1 = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    doc_chair(ourShader, translateMatrix * glm::rotate(identityMatrix, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f)), color1);
 }
 
-// glfw: whenever the window size changed (by OS or user resize) this callback function executes
-// ---------------------------------------------------------------------------------------------
-void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+//Records one composite object at the origin into batch, to be drawn through setInstances()
+void recordPrototype(StaticBatch& batch, Shader& ourShader, void (*object)(Shader&, glm::mat4, glm::vec4))
 {
-    // make sure the viewport matches the new window dimensions; note that width and
-    // height will be significantly larger than specified on retina displays.
-    glViewport(0, 0, width, height);
+    ourShader.use();
+    cubeRecorder = &batch;
+    batch.begin();
+    object(ourShader, glm::mat4(1.0f), glm::vec4(1.0f));
+    batch.end();
+    cubeRecorder = NULL;
 }
 
-
-// glfw: whenever the mouse moves, this callback is called
-// -------------------------------------------------------
-void mouse_callback(GLFWwindow* window, double xposIn, double yposIn)
+//Object space box of everything object draws at the origin, for culling it per frame
+BoundingBox measureObject(Shader& ourShader, void (*object)(Shader&, glm::mat4, glm::vec4))
 {
-    float xpos = static_cast<float>(xposIn);
-    float ypos = static_cast<float>(yposIn);
-
-    if (firstMouse)
-    {
-        lastX = xpos;
-        lastY = ypos;
-        firstMouse = false;
-    }
+    BoundingBox bounds;
+    ourShader.use();
+    boundsRecorder = &bounds;
+    object(ourShader, glm::mat4(1.0f), glm::vec4(1.0f));
+    boundsRecorder = NULL;
+    return bounds;
+}
 
-    float xoffset = xpos - lastX;
-    float yoffset = lastY - ypos; // reversed since y-coordinates go from bottom to top
+//Frustum and room test against this frame's view, counted for the title overlay
+bool isVisible(const BoundingBox& box)
+{
+    cullCounters.tested++;
+    if (viewFrustum.intersects(box) && cullCells->intersects(box))
+        return true;
+    cullCounters.culled++;
+    return false;
+}
 
-    lastX = xpos;
-    lastY = ypos;
+//A door drawn rotated by doorAngle is shut when it lines up with its wall again
+bool doorShut(float doorAngle, float shutAngle)
+{
+    return fmod(doorAngle - shutAngle, 360.0f) == 0.0f;
+}
 
-    camera.ProcessMouseMovement(xoffset, yoffset);
+//The ground floor double door is shut at angle 90 / angle1 -90, the upstairs doors at angle 0
+bool groundDoorsOpen()
+{
+    return !doorShut(angle, 90.0f) || !doorShut(angle1, -90.0f);
 }
 
-// glfw: whenever the mouse scroll wheel scrolls, this callback is called
-// ----------------------------------------------------------------------
-void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+bool upperDoorsOpen()
 {
-    camera.ProcessMouseScroll(static_cast<float>(yoffset));
+    return !doorShut(angle, 0.0f);
 }
 
+bool entranceGateOpen()
+{
+    return gateOpenCurrent > 0.0f;
+}
 
-//Texture Loading
+//Rooms of the hospital building as cells, the ground floor reaching down to take
+//in the floor slabs. The upstairs slab at y 1.98 splits the two floors, the wall
+//at x 10.7 splits the ground floor, and upstairs the x 5.5/11.5 partitions and the
+//z 2.0/9.0 walls make four rooms off a corridor. Everything else is the exterior,
+//seen through the entrance gate and the opening above it
+void buildHospitalCells(CellGraph& cells)
+{
+    BoundingBox building;
+    building.expand(glm::vec3(-2.0f, -0.8f, -4.0f));
+    building.expand(glm::vec3(18.15f, 4.58f, 15.1f));
+    int exterior = cells.setExterior(building);
+
+    BoundingBox box;
+    box = BoundingBox(); box.expand(glm::vec3(-2.0f, -0.8f, -4.0f)); box.expand(glm::vec3(10.735f, 1.98f, 15.1f));
+    int groundWest = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(10.735f, -0.8f, -4.0f)); box.expand(glm::vec3(18.15f, 1.98f, 15.1f));
+    int groundEast = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(-2.0f, 1.98f, -4.0f)); box.expand(glm::vec3(5.5625f, 4.58f, 15.1f));
+    int upperWest = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(5.5625f, 1.98f, 2.0625f)); box.expand(glm::vec3(18.15f, 4.58f, 9.0625f));
+    int corridor = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(5.5625f, 1.98f, -4.0f)); box.expand(glm::vec3(11.5625f, 4.58f, 2.0625f));
+    int roomA = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(11.5625f, 1.98f, -4.0f)); box.expand(glm::vec3(18.15f, 4.58f, 2.0625f));
+    int roomB = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(5.5625f, 1.98f, 9.0625f)); box.expand(glm::vec3(11.5625f, 4.58f, 15.1f));
+    int roomC = cells.addCell(box);
+    box = BoundingBox(); box.expand(glm::vec3(11.5625f, 1.98f, 9.0625f)); box.expand(glm::vec3(18.15f, 4.58f, 15.1f));
+    int roomD = cells.addCell(box);
+
+    //entrance gate, the slit its shut panels still leave, the gap beside it and the
+    //opening above it
+    box = BoundingBox(); box.expand(glm::vec3(6.6f, -0.45f, 15.0f)); box.expand(glm::vec3(9.65f, 2.1f, 15.1f));
+    cells.addPortal(exterior, groundWest, box, entranceGateOpen);
+    box = BoundingBox(); box.expand(glm::vec3(8.125f, -0.45f, 15.0f)); box.expand(glm::vec3(8.175f, 2.1f, 15.1f));
+    cells.addPortal(exterior, groundWest, box);
+    box = BoundingBox(); box.expand(glm::vec3(9.65f, -0.45f, 15.0f)); box.expand(glm::vec3(10.45f, 2.1f, 15.1f));
+    cells.addPortal(exterior, groundWest, box);
+    box = BoundingBox(); box.expand(glm::vec3(6.6f, 2.1f, 15.0f)); box.expand(glm::vec3(10.45f, 4.58f, 15.1f));
+    cells.addPortal(exterior, roomC, box);
+    //ground floor double door
+    box = BoundingBox(); box.expand(glm::vec3(10.7f, -0.45f, 7.0f)); box.expand(glm::vec3(10.77f, 1.6f, 9.0f));
+    cells.addPortal(groundWest, groundEast, box, groundDoorsOpen);
+    //stairwell and lift well through the upstairs slab
+    box = BoundingBox(); box.expand(glm::vec3(-1.9f, 1.92f, -0.78f)); box.expand(glm::vec3(2.38f, 2.04f, 10.4f));
+    cells.addPortal(groundWest, upperWest, box);
+    box = BoundingBox(); box.expand(glm::vec3(-1.9f, 1.92f, 13.52f)); box.expand(glm::vec3(2.38f, 2.04f, 15.0f));
+    cells.addPortal(groundWest, upperWest, box);
+    //upstairs: the corridor opens to the west, the rooms have a door each
+    box = BoundingBox(); box.expand(glm::vec3(5.5f, 1.98f, 2.2f)); box.expand(glm::vec3(5.625f, 4.58f, 8.9f));
+    cells.addPortal(upperWest, corridor, box);
+    box = BoundingBox(); box.expand(glm::vec3(8.0f, 1.9f, 2.0f)); box.expand(glm::vec3(9.2f, 3.9f, 2.125f));
+    cells.addPortal(corridor, roomA, box, upperDoorsOpen);
+    box = BoundingBox(); box.expand(glm::vec3(14.2f, 1.9f, 2.0f)); box.expand(glm::vec3(15.4f, 3.9f, 2.125f));
+    cells.addPortal(corridor, roomB, box, upperDoorsOpen);
+    box = BoundingBox(); box.expand(glm::vec3(8.0f, 1.9f, 9.0f)); box.expand(glm::vec3(9.2f, 3.9f, 9.125f));
+    cells.addPortal(corridor, roomC, box);
+    box = BoundingBox(); box.expand(glm::vec3(14.2f, 1.9f, 9.0f)); box.expand(glm::vec3(15.4f, 3.9f, 9.125f));
+    cells.addPortal(corridor, roomD, box, upperDoorsOpen);
+}
 
-void load_texture(unsigned int& texture, string image_name, GLenum format, bool repeat)
+//The colors the object helpers draw with, named once instead of written out at every draw
+void defineMaterials()
 {
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
+    materialTable.define("grey", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), glm::vec4(0.25f, 0.25f, 0.25f, 0.25f), 32.0f);
+    materialTable.define("white", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f), glm::vec4(1.0f, 1.0f, 1.0f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("black", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f), glm::vec4(0.0f, 0.0f, 0.0f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("skyBlue", glm::vec4(0.52f, 0.8f, 0.92f, 0.5f), glm::vec4(0.52f, 0.8f, 0.92f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("solidWhite", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("porcelain", glm::vec4(0.97f, 0.94f, 0.94f, 1.0f), glm::vec4(0.97f, 0.94f, 0.94f, 1.0f), glm::vec4(0.97f, 0.94f, 0.94f, 1.0f), 128.0f);
+    materialTable.define("steel", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f), glm::vec4(0.26f, 0.26f, 0.25f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("orange", glm::vec4(0.9f, 0.3f, 0.0f, 1.0f), glm::vec4(0.9f, 0.3f, 0.0f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("silver", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f), glm::vec4(0.9f, 0.9f, 1.0f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("solidBlack", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("slateBlue", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f), glm::vec4(0.42f, 0.45f, 0.65f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("blue", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f), glm::vec4(0.0f, 0.0f, 1.0f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("green", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f), glm::vec4(0.0f, 1.0f, 0.0f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("maroon", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f), glm::vec4(0.38f, 0.11f, 0.18f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("scarlet", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f), glm::vec4(1.0f, 0.14f, 0.0f, 0.5f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("lightBlue", glm::vec4(0.52f, 0.80f, .98f, 1.0f), glm::vec4(0.52f, 0.80f, .98f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("redLight", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f), glm::vec4(0.961f, 0.169f, 0.0f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("amber", glm::vec4(1.0f, 0.75f, 0.0f, 1.0f), glm::vec4(1.0f, 0.75f, 0.0f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    materialTable.define("glossyWhite", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), 32.0f);
+    materialTable.define("charcoal", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f), glm::vec4(0.2f, 0.2f, 0.2f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("paleGreen", glm::vec4(0.2f, 1.0f, 0.2f, 1.0f), glm::vec4(0.2f, 1.0f, 0.2f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("royalBlue", glm::vec4(0.2f, 0.2f, 1.0f, 1.0f), glm::vec4(0.2f, 0.2f, 1.0f, 1.0f), glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
+    materialTable.define("darkGrey", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f), glm::vec4(0.1f, 0.1f, 0.1f, 1.0f), glm::vec4(0.3f, 0.3f, 0.3f, 1.0f), 32.0f);
+    materialTable.define("moss", glm::vec4(0.2f, 0.2f, 0.2f, 1.0f), glm::vec4(0.3f, 0.4f, 0.3f, 1.0f), glm::vec4(0.3f, 0.4f, 0.3f, 1.0f), 32.0f);
+}
 
+//Selects a material of the table for the next draws
+void setMaterial(Shader& ourShader, int material)
+{
+    materialTable.upload();
+    ourShader.setInt(materialIndexLoc, material);
+}
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+void setMaterial(Shader& ourShader, const char* name)
+{
+    setMaterial(ourShader, materialTable.find(name));
+}
 
-    if (repeat) {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    }
-    else {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    }
+//Materials that follow a color passed in at draw time are looked up by value
+void setMaterial(Shader& ourShader, glm::vec4 ambient, glm::vec4 diffuse, glm::vec4 specular, float shininess)
+{
+    setMaterial(ourShader, materialTable.intern(ambient, diffuse, specular, shininess));
+}
 
-    int width, height, nrChannels;
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(image_name.c_str(), &width, &height, &nrChannels, 0);
-    if (data)
+//Every object helper draws its cubes through here so the static batch can capture them
+void drawCubeElements(Shader& ourShader)
+{
+    if (cubeRecorder != NULL)
+        cubeRecorder->capture(ourShader);
+    else if (boundsRecorder != NULL)
     {
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        const float* model = RenderState::current().cachedUniform(modelLoc);
+        glm::mat4 matrix = glm::mat4(1.0f);
+        if (model != NULL)
+            memcpy(&matrix[0][0], model, sizeof(matrix));
+        boundsRecorder->expand(cubeBounds.transformed(matrix));
     }
     else
     {
-        cout << "Failed to load texture " << image_name << endl;
+        RenderState& state = RenderState::current();
+        const float* model = state.cachedUniform(modelLoc);
+        glm::mat4 matrix = glm::mat4(1.0f);
+        if (model != NULL)
+            memcpy(&matrix[0][0], model, sizeof(matrix));
+        //the streamer sizes the texture by how large this cube is on screen
+        if (model != NULL && textureStreamer.wantsBoxes())
+            textureStreamer.nextDrawCovers(cubeBounds.transformed(matrix));
+        if (cubeQueue != NULL && cubeQueue->recording())
+        {
+            int material = 0;
+            const float* index = state.cachedUniform(materialIndexLoc);
+            if (index != NULL)
+                memcpy(&material, index, sizeof(material));
+            //the listener hears about the cube now, the queued draw stands for many
+            if (state.currentDrawListener() != NULL)
+                state.currentDrawListener()->drawn(state.boundTexture(0));
+            cubeQueue->add(matrix, material, state.boundTexture(0));
+        }
+        else
+            drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     }
-    stbi_image_free(data);
 }
 
 //OBJECTS
 
-void drawCube(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), float spec = 1.0f, float shininess = 32.0f)
+void drawCube(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f), float spec = 1.0f, float shininess = 32.0f)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateYMatrix;
@@ -3158,39 +3847,33 @@ void drawCube(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color = glm::vec
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-1.0f, 1.0f, 1.0f));
     model = translateMatrix * rotateYMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * spec);
-    ourShader.setFloat("material.shininess", shininess);
+    setMaterial(ourShader, color, color, color * spec, shininess);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 }
-void door(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void door(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateYMatrix;
 
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     //Left Side
     rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.4f, 4.0f, 0.2f));
     model = translateMatrix * rotateYMatrix * scaleMatrix;
 
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
     // 9.6 9.95
     // -0.42 0.45
     // 7.6 7.575
 
-    glBindTexture(GL_TEXTURE_2D, texture9);
+    bindTexture(GL_TEXTURE_2D, tex("gateWood"));
     //glass
     rotateYMatrix = glm::rotate(identityMatrix, glm::radians(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-9.6 + 9.95f, +0.42 + 0.45f, -7.6 + 7.575f));
@@ -3200,14 +3883,11 @@ void door(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 
 
 
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
-    //glBindTexture(GL_TEXTURE_2D, texture7);
+    //glBindTexture(GL_TEXTURE_2D, tex("concrete2"));
     ///*translateMatrix = glm::translate(identityMatrix, glm::vec3(7.1f, -0.42f, 7.5f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.5f, 3.2f, 0.2f));
     //model = translateMatrix * scaleMatrix;*/
@@ -3215,18 +3895,24 @@ void door(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(7.1f, -0.42f, 7.5f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.5f, 3.2f, 0.2f));
     //model = translateMatrix * rotateYMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", color * 0.5f);
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, color * 0.5f);
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
 }
 
 //mri
-void MRI(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere sphere)
+//MRI table goes in while someone is inside, run every frame whether or not it is drawn
+void updateMRI()
+{
+    animations.drive(mriAnimation, mriInside ? 1.0f : -1.0f);
+}
+
+void MRI(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere& sphere)
 {
 
     /*if ((-1.0 - camera.Position.z) <= 0 && (3.0 - camera.Position.z) >= 0 && (camera.Position.x - 5.0) <= 4.0 && (camera.Position.x - 5.0) >= 0.0)
@@ -3238,18 +3924,6 @@ void MRI(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere sphere)
         mriInside = false;
     }
     cout << mriInside << endl;*/
-    if (mriInside)
-    {
-        mriRotateAngle += mriSpeed;
-        mriTranslate += (0.15 * glm::radians(mriRotateAngle));
-        mriTranslate = min(mriTranslate, 3.0);
-    }
-    else
-    {
-        mriRotateAngle += mriSpeed;
-        mriTranslate -= (0.15 * glm::radians(mriRotateAngle));
-        mriTranslate = max(mriTranslate, 0.0);
-    }
 
     //cout << glm::radians(mriRotateAngle) << endl;
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
@@ -3257,73 +3931,64 @@ void MRI(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere sphere)
     //moveable
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(2.0f - mriTranslate, 4.1f, 10.25f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(7.0f, 0.3f, 3.0f));
-    //ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     ////glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     //base
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.5f, 3.1f, 9.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 1.7f, 6.0f));
-    ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    setMaterial(ourShader, "solidWhite");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //fr
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.5f, 3.1f, 12.4f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.5f, 0.2f));
-    ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    setMaterial(ourShader, "solidWhite");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //bc
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.5f, 3.1f, 9.4f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.5f, 0.2f));
-    ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    setMaterial(ourShader, "solidWhite");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
     ////leg
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f - mriTranslate, 3.3f, 10.7f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 1.6f, 0.1f));
-    //ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f - mriTranslate, 3.3f, 11.3f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 1.6f, 0.1f));
-    //ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f - mriTranslate, 3.2f, 10.7f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.1f, 1.0f));
-    //ourShader.setMat4("model", moveMatrix * translateMatrix * scaleMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * translateMatrix * scaleMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
@@ -3331,18 +3996,18 @@ void MRI(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere sphere)
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(5.0f - mriTranslate, 3.2f, 11.3f));
     //rotateXMatrix = glm::rotate(identityMatrix, glm::radians(0.0f + mriRotateAngle), glm::vec3(1.0f, 0.0f, 0.0f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.5f, 0.2f));
-    //ourShader.setMat4("model", moveMatrix * translateMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * translateMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     //sphere.drawSphere(ourShader);
 
 
 }
 
-void porda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void porda(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateYMatrix;
@@ -3353,28 +4018,22 @@ void porda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.1f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.2f, 1.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //lomba danda
     //rotateYMatrix = glm::rotate(identityMatrix, glm::radians(45.0f), glm::vec3(0.0f, 1.0f, 0.0f));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 3.3f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     //plane danda
@@ -3382,14 +4041,11 @@ void porda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 1.6f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 0.1f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     // nicher danda
@@ -3397,28 +4053,22 @@ void porda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.45f, -0.1f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.2f, 1.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //lomba danda
     //rotateYMatrix = glm::rotate(identityMatrix, glm::radians(45.0f), glm::vec3(0.0f, 1.0f, 0.0f));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.45f, 0.0f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 3.3f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     //choto danda
@@ -3426,48 +4076,39 @@ void porda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.2f, 1.45f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 0.3f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.25f, 1.45f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 0.3f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     //cloth
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.152f, 0.3f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.4f, 2.4f, 0.1f));
-    glBindTexture(GL_TEXTURE_2D, texture8);
+    bindTexture(GL_TEXTURE_2D, tex("curtain"));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", 0.5f, 0.5f, 0.5f, 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
 }
 
-void Bed(Shader ourShader, glm::mat4 moveMatrix)
+void Bed(Shader& ourShader, glm::mat4 moveMatrix)
 {
 
     float tableY = 0.02f;
@@ -3479,12 +4120,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f + tableY, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.4f, 0.1f, 1.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.97f, 0.94f, 0.94f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.97f, 0.94f, 0.94f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.97f, 0.94f, 0.94f, 1.0f));
-    ourShader.setFloat("material.shininess", 128.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "porcelain");
+    drawCubeElements(ourShader);
 
 
     // Leg 1
@@ -3493,12 +4131,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, -0.46f + tableY1, 0.01f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.1f, 1.3f, 0.1f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // Leg 2
@@ -3507,12 +4142,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(0.02f, -0.46f + tableY1, 0.43f));
     scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.1f, 1.3f, 0.1f));
     model2 = translateMatrix2 * scaleMatrix2;
-    ourShader.setMat4("model", moveMatrix * model2);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model2);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // Leg 3
@@ -3520,12 +4152,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, -0.46f + tableY, 0.01f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.1f, 1.0f, 0.1f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // Leg 4
@@ -3533,12 +4162,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(1.15f, -0.46f + tableY, 0.43f));
     scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.1f, 1.0f, 0.1f));
     model2 = translateMatrix2 * scaleMatrix2;
-    ourShader.setMat4("model", moveMatrix * model2);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model2);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
 
@@ -3547,35 +4173,26 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, 0.05f + tableY, 0.48f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, 0.05f + tableY, 0.30f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, 0.05f + tableY, 0.20f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // top 2
@@ -3583,35 +4200,26 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, 0.05f + tableY, 0.01f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, 0.05f + tableY, 0.30f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, 0.05f + tableY, 0.20f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // top 3
@@ -3619,12 +4227,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, 0.05f + tableY, 0.48f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     // top 4
@@ -3632,12 +4237,9 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, 0.05f + tableY, 0.01f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, .4f, 0.05f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     //Top flat1
@@ -3645,35 +4247,26 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, .25f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, .08f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
     //down flat1
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.02f, -.35f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     //Top flat2
@@ -3681,22 +4274,16 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, .25f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, .08f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 
 
     //dowb flat2
@@ -3704,15 +4291,12 @@ void Bed(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(1.15f, -.35f + tableY, 0.0f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.05f, 0.05f, 1.015f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.26f, 0.26f, 0.25f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "steel");
+    drawCubeElements(ourShader);
 }
 
-void Chair(Shader ourShader, glm::mat4 moveMatrix)
+void Chair(Shader& ourShader, glm::mat4 moveMatrix)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -3725,12 +4309,9 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.11f, 0.2f - fixY + fixYWhole, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.75f, 0.07f, 1.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.3f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.3f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "orange");
+    drawCubeElements(ourShader);
 
     // Leg 1
     glm::mat4 identityMatrix1 = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
@@ -3738,12 +4319,9 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.13f, -0.32f + fixYWhole, 0.00f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.07f, 1.25f * fixLeg, 0.07f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    setMaterial(ourShader, "silver");
+    drawCubeElements(ourShader);
 
 
     // Leg 2
@@ -3752,12 +4330,12 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(0.13f, -0.32f + fixYWhole, 0.45f));
     scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.07f, 1.25f * fixLeg, 0.07f));
     model2 = translateMatrix2 * scaleMatrix2;
-    ourShader.setMat4("model", moveMatrix * model2);
-    /*ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);*/
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model2);
+    /*ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    ourShader.setFloat(materialShininessLoc, 32.0f);*/
+    drawCubeElements(ourShader);
 
 
     //// Leg 3
@@ -3765,12 +4343,12 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix1 = glm::translate(identityMatrix1, glm::vec3(0.43f, -0.32f + fixYWhole, 0.01f));
     scaleMatrix1 = glm::scale(identityMatrix1, glm::vec3(0.07f, 1.25f * fixLeg, 0.07f));
     model1 = translateMatrix1 * scaleMatrix1;
-    ourShader.setMat4("model", moveMatrix * model1);
-    /*ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);*/
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model1);
+    /*ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    ourShader.setFloat(materialShininessLoc, 32.0f);*/
+    drawCubeElements(ourShader);
 
 
     // Leg 4
@@ -3778,23 +4356,23 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(0.43f, -0.32f + fixYWhole, 0.45f));
     scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.07f, 1.25f * fixLeg, 0.07f));
     model2 = translateMatrix2 * scaleMatrix2;
-    ourShader.setMat4("model", moveMatrix * model2);
-    /*ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);*/
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model2);
+    /*ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    ourShader.setFloat(materialShininessLoc, 32.0f);*/
+    drawCubeElements(ourShader);
 
 
     ////Left up 
     //translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(0.17f, 0.01f - fixY + fixYWhole, 0.29f));
     //scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.07f, 0.25f, 0.07f));
     //model2 = translateMatrix2 * scaleMatrix2;
-    //ourShader.setMat4("model", moveMatrix * model2);
-    //ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model2);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
@@ -3802,26 +4380,26 @@ void Chair(Shader ourShader, glm::mat4 moveMatrix)
     //translateMatrix2 = glm::translate(identityMatrix2, glm::vec3(0.39f, 0.01f - fixY + fixYWhole, 0.29f));
     //scaleMatrix2 = glm::scale(identityMatrix2, glm::vec3(0.07f, 0.25f, 0.07f));
     //model2 = translateMatrix2 * scaleMatrix2;
-    //ourShader.setMat4("model", moveMatrix * model2);
-    //ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model2);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     ////Back support
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.15f, 0.09f - fixY + fixYWhole, 0.28f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 0.5f, 0.1f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", glm::vec4(0.9f, 0.3f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(0.9f, 0.3f, 1.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(0.9f, 0.3f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.9f, 0.3f, 1.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 }
 
-void Floor(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void Floor(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -3829,179 +4407,140 @@ void Floor(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.9f, 1.10f, -6.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(43.3f, 1.2f, 40.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 }
 
 
-void doc_chair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void doc_chair(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.50f, 0.30f, 1.20f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
     //choto
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.20f, 0.65f, 1.20f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
     //helen
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.15f, 0.27f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.20f, 1.65f, 1.20f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(10.0f), glm::vec3(0.0f, 0.0f, 1.0f));
     model = rotateZMatrix * translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     // handles
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.33f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.4f, 0.1f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.7f, 0.13f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.33f, 0.54f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.4f, 0.1f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.7f, 0.13f, 0.54f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
     //nicher part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.4f, -0.26f, 0.28f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.7f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.2f, -0.3f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.2f, 0.2f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.42f, -0.3f, 0.05f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.2f, 1.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
+    drawCubeElements(ourShader);
 
 
 
 }
 
-void wheelChair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void wheelChair(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
     //main part
 
-    glBindTexture(GL_TEXTURE_2D, texture17);
+    bindTexture(GL_TEXTURE_2D, tex("wheelchair"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.00f, 0.30f, 1.90f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //uporer part
-    glBindTexture(GL_TEXTURE_2D, texture17);
+    bindTexture(GL_TEXTURE_2D, tex("wheelchair"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.1f, 0.0f, -0.1f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.00f, 2.50f, 0.30f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
@@ -4011,408 +4550,330 @@ void wheelChair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 
 
 
-void doc_table(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void doc_table(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
     //upper part
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.2f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.5f, 0.2f, 2.5f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
     //lower part
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, -0.5f, 0.05f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.0f, 1.5f, 2.3f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
 
 }
 
-void pat_chair(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void pat_chair(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture11);
+    bindTexture(GL_TEXTURE_2D, tex("sofa"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.50f, 0.10f, 1.20f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //danda
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 0.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 0.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
     // leg danda
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, -0.50f, 0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 1.00f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, -0.50f, 0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 1.00f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
     //nicer support
     //danda
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, -0.45f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 0.10f, 1.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, -0.45f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.10f, 0.10f, 1.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, -0.45f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 0.10f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.42f, 0.45f, 0.65f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "slateBlue");
+    drawCubeElements(ourShader);
 
     //bach support
 
-    glBindTexture(GL_TEXTURE_2D, texture11);
+    bindTexture(GL_TEXTURE_2D, tex("sofa"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.2f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, 0.70f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 }
 
 
-void mri_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void mri_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.27f, 0.0f, 1.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.80f, 0.7f, 0.80f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.22f, -0.3f, 1.2f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.7f, 1.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     //upper part first of blue
-    glBindTexture(GL_TEXTURE_2D, texture15);
+    bindTexture(GL_TEXTURE_2D, tex("bed"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 0.0f + movemribed));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
 
 }
 
-void xray_danda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void xray_danda(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.5f, 0.0f, 0.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.50f, 0.50f, 0.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.2f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.7f, 0.7f, 0.7f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, -0.02f, 0.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.5f, 0.5f, 0.5f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.015f, 0.4f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 0.2f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.02f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.1f, 1.5f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 }
 
-void xray_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void xray_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     //glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     //glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     ////upor part
-    //glBindTexture(GL_TEXTURE_2D, texture0);
+    //glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.3f, 0.0f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     ////last main part
-    //glBindTexture(GL_TEXTURE_2D, texture0);
+    //glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.27f, 0.0f, 1.3f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.80f, 0.7f, 0.80f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    //glBindTexture(GL_TEXTURE_2D, texture0);
+    //glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.22f, -0.3f, 1.2f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.7f, 1.1f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    //glBindTexture(GL_TEXTURE_2D, texture0);
+    //glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.5f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 4.00f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     ////upper part first of blue
-    //glBindTexture(GL_TEXTURE_2D, texture15);
+    //glBindTexture(GL_TEXTURE_2D, tex("bed"));
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 0.0f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.27f, 0.0f, 1.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.80f, 0.7f, 0.80f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.22f, -0.3f, 1.2f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.7f, 1.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     //upper part first of blue
-    glBindTexture(GL_TEXTURE_2D, texture15);
+    bindTexture(GL_TEXTURE_2D, tex("bed"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 0.0f + movemribed));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
@@ -4420,188 +4881,146 @@ void xray_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
 }
 
-void sofa(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void sofa(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
 
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.2f, -3.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.4f, 6.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture11);
+    bindTexture(GL_TEXTURE_2D, tex("sofa"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.4f, -2.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.4f, 5.65f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 1.7f, .30f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.005f, 0.355f, -01.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.5f, .05f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.005f, 0.355f, -00.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.5f, .05f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture6);
+    bindTexture(GL_TEXTURE_2D, tex("stairs"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.001f, 0.0f, -2.84f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.7f, 5.65f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, -3.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 1.7f, .30f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 }
 
 
-void AC_1(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void AC_1(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.00f, 0.7f, 2.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.90f, 0.1f, 2.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.1f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.00f, 0.1f, 2.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 }
 
-void pat_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void pat_bed(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 6.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.27f, 0.0f, 1.3f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.80f, 0.7f, 0.80f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.22f, -0.3f, 1.2f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.7f, 1.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.3f, 0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     //upper part first of blue
-    glBindTexture(GL_TEXTURE_2D, texture15);
+    bindTexture(GL_TEXTURE_2D, tex("bed"));
 
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 0.0f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 2.00f));
@@ -4610,716 +5029,546 @@ void pat_bed(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 1.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, -2.00f));
     model = translateMatrix * glm::rotate(glm::mat4(1.0f), glm::radians(patbedangle), glm::vec3(1.0f, 0.0f, 0.0f)) * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     //upper part first of blue
-    glBindTexture(GL_TEXTURE_2D, texture15);
+    bindTexture(GL_TEXTURE_2D, tex("bed"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.35f, 1.1f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 0.150f, 3.60f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
 
 }
 
-void hospital(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void hospital(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //H----------------
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.2f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.5f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
     //0------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.2f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, 0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
 
     //s-----------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.55f, 0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.55f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.55f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.55f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 0.8f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.91f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 0.8f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
 
     //p-------------------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.2f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.2f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.2f, 0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.55f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 0.8f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
     //I----------------------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.85f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
     //T----------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.15f, 0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.1f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.35f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
     //A--------------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.9f, 0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.1f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f)); // Specular remains same
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "green");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.9f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.1f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "green");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.9f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "green");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(4.3f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f)); // Green
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "green");
+    drawCubeElements(ourShader);
 
 
     //L-------------------------
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(4.6f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.30f, 1.50f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(4.6f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.1f, 0.30f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix* model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix* model);
+    setMaterial(ourShader, "blue");
+    drawCubeElements(ourShader);
 
 
 
 
 }
-void book_self(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void book_self(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.50f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //books
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.15f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.2f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.3f, 0.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
 
     //books upore
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.15f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.2f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.3f, 1.05f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, .5f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.50f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 1.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.50f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 1.45f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.50f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
     //side
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 3.00f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //side
-    glBindTexture(GL_TEXTURE_2D, texture12);
+    bindTexture(GL_TEXTURE_2D, tex("entranceWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.25f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 3.00f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //books
 
 
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.2f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.15f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.10f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.05f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.0f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.14f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "scarlet");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.95f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, .70f, 1.00f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.38f, 0.11f, 0.18f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "maroon");
+    drawCubeElements(ourShader);
 }
 
-void stool(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void stool(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.1f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.3f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //thak
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.05f, 0.55f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.5f, .10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //side
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.8f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.50f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
     //side
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.50f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 }
 
-void entrancegate(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+//Gate and lift movement, run every frame whether or not they are drawn
+void updateEntranceGate()
 {
-    glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-    glm::mat4 translateMatrix, scaleMatrix, model;
-
     //if ((13.5f - camera.Position.z) <= 2.0f && (13.5f - camera.Position.z) >= 0 && camera.Position.x > 10.1 && camera.Position.x < 1.0)
     if (camera.Position.z >= 13.593 && camera.Position.z <= 17.6216 && camera.Position.x > 7.2 && camera.Position.x < 8.3)
     {
@@ -5330,71 +5579,104 @@ void entrancegate(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
         isgateOpening = false;
     }
 
-    if (isgateOpening)
-    {
-        gateOpenCurrent += gateOpeningSpeed;
-        gateOpenCurrent = min(gateOpenCurrent, 2.7f);
-    }
-    else
+    animations.drive(gateAnimation, isgateOpening ? 1.0f : -1.0f);
+    //cout << gateOpenCurrent << ' ' << camera.Position.x << ' ' << camera.Position.z << endl;
+    animations.drive(liftAnimation, isLiftGoingUp ? 1.0f : 0.0f);
+}
+
+//A ceiling light every few meters in every room and corridor, one on the lamp post
+//and six over each stress ward. They start switched off, like the point light
+void addWardLights(std::vector<PointLight>& lights, const CellGraph& cells)
+{
+    const float spacing = 3.0f;
+    const glm::vec4 ambient = glm::vec4(0.05f, 0.05f, 0.05f, 1.0f);
+    const glm::vec4 diffuse = glm::vec4(0.6f, 0.6f, 0.55f, 1.0f);
+    const glm::vec4 specular = glm::vec4(0.3f, 0.3f, 0.3f, 1.0f);
+    for (int cell = 0; cell < cells.cellCount(); cell++)
     {
-        gateOpenCurrent -= gateOpeningSpeed;
-        gateOpenCurrent = max(gateOpenCurrent, 0.0f);
+        if (cells.isExterior(cell))
+            continue;
+        const BoundingBox& box = cells.cellBox(cell);
+        int columns = std::max(1, (int)((box.max.x - box.min.x) / spacing));
+        int rows = std::max(1, (int)((box.max.z - box.min.z) / spacing));
+        for (int row = 0; row < rows; row++)
+            for (int column = 0; column < columns; column++)
+            {
+                glm::vec3 position = glm::vec3(box.min.x + (column + 0.5f) * (box.max.x - box.min.x) / columns, box.max.y - 0.3f,
+                    box.min.z + (row + 0.5f) * (box.max.z - box.min.z) / rows);
+                lights.push_back(PointLight(position, ambient, diffuse, specular, 1.0f, 0.7f, 1.8f, (int)lights.size() + 2));
+            }
     }
-    //cout << gateOpenCurrent << ' ' << camera.Position.x << ' ' << camera.Position.z << endl;
-   if (isLiftGoingUp)
+    lights.push_back(PointLight(glm::vec3(10.2f, 3.0f, 14.5f), ambient, diffuse, specular, 1.0f, 0.35f, 0.44f, (int)lights.size() + 2));
+    for (int ward = 0; ward < stressWards; ward++)
     {
-        liftUpCurrent += liftUpSpeed;
-        liftUpCurrent = min(liftUpCurrent, 2.35f);
+        glm::vec3 wardOrigin = glm::vec3(45.0f + (ward % 5) * 18.0f, -0.2f, -(ward / 5) * 20.0f);
+        for (int i = 0; i < 6; i++)
+            lights.push_back(PointLight(wardOrigin + glm::vec3(2.4f + (i % 3) * 5.6f, 3.0f, 2.0f + (i / 3) * 8.0f), ambient, diffuse, specular, 1.0f, 0.7f, 1.8f, (int)lights.size() + 2));
     }
+    for (PointLight& light : lights)
+        light.turnOff();
+}
+
+//Every moving part with its range and speed. The rates are what the parts
+//used to move per frame, at 60 frames a second
+void defineAnimations()
+{
+    gateAnimation = animations.add(&gateOpenCurrent, 0.0f, 2.7f, gateOpeningSpeed);
+    liftAnimation = animations.add(&liftUpCurrent, 0.0f, 2.35f, liftUpSpeed);
+    mriAnimation = animations.add(&mriTranslate, 0.0f, 3.0f, mriSpeed);
+    mriBedAnimation = animations.add(&movemribed, -1.5f, 0.0f, 0.6f, ANIMATION_BOUNCE);
+    xrayAnimation = animations.add(&xraypos, -0.5f, 0.3f, 0.6f, ANIMATION_BOUNCE);
+    patBedAnimation = animations.add(&patbedangle, 0.0f, 45.0f, 60.0f, ANIMATION_BOUNCE);
+    //the cart has no end, it rolls for as long as the key is held
+    cartAnimation = animations.add(&transX1, 0.0f, FLT_MAX, 0.6f);
+    doorAnimation = animations.add(&angle, 0.0f, 90.0f, 60.0f);
+    door1Animation = animations.add(&angle1, -90.0f, 0.0f, 60.0f);
+    fanAnimation = animations.add(&rotateAngle_Y, 0.0f, 360.0f, fanSpeed, ANIMATION_WRAP);
+}
+
+void entrancegate(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+{
+    glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
+    glm::mat4 translateMatrix, scaleMatrix, model;
+
     //main part
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.7f - gateOpenCurrent, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.95f, 5.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.7f + gateOpenCurrent, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-2.95f, 5.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
     //choto glass
-    glBindTexture(GL_TEXTURE_2D, texture9);
+    bindTexture(GL_TEXTURE_2D, tex("gateWood"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(4.7f - gateOpenCurrent, 1.0f, 13.45f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.95f, 1.5f, 0.38f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-    glBindTexture(GL_TEXTURE_2D, texture9);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
+    bindTexture(GL_TEXTURE_2D, tex("gateWood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(5.7f + gateOpenCurrent, 1.0f, 13.45f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-0.95f, 1.5f, 0.38f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 }
 
-void Lift(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void Lift(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -5402,25 +5684,19 @@ void Lift(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.7f, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 9.1f, 3.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //right side
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.7f, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 9.1f, 3.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     //open
 
@@ -5431,56 +5707,47 @@ void Lift(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.7f, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.95f - liftOpenCurrent, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.7f, 0.0f, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-2.95f + liftOpenCurrent, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
     ///////////////////
 
     ///////////////
 
 
     //base
-    glBindTexture(GL_TEXTURE_2D, texture11);
+    bindTexture(GL_TEXTURE_2D, tex("sofa"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.7f, 0.05f + liftUpCurrent, 13.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(6.0f, 0.4f, 3.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     ////2nd floor
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(3.7f, 3.0f, 13.5f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.97f, 3.5f - liftOpenCurrent, 0.2f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(6.7f, 3.0f, 13.5f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(-2.97f, 3.5f + liftOpenCurrent, 0.2f));
     //model = translateMatrix * scaleMatrix;
-    //ourShader.setMat4("model", moveMatrix * model);
-    //ourShader.setVec4("material.ambient", color);
-    //ourShader.setVec4("material.diffuse", color);
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix * model);
+    //ourShader.setVec4(materialAmbientLoc, color);
+    //ourShader.setVec4(materialDiffuseLoc, color);
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
     //glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
@@ -5488,108 +5755,84 @@ void Lift(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 
 
 
-void pat_lathi(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void pat_lathi(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.0f, 0.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.050f, .20f, 0.050f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.08f, 0.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.050f, .050f, 1.550f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.0f, .5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.050f, .20f, 0.050f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.0f, 1.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.050f, .20f, 0.050f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.0f, 0.75f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.050f, .20f, 0.050f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 }
 
-void xray_lathi(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void xray_lathi(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.25f, 0.0f, 0.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.20f, 4.00f, 0.20f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.00f, 0.10f, 1.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.2f, 2.0f, 0.2f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.50f, 0.10f, 0.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 }
@@ -5602,16 +5845,13 @@ void line_strip(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, -0.6f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.20f, .10f, 8.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 
 
@@ -5623,16 +5863,13 @@ void sign_board(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.6f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.00f, 1.00f, 0.10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 }
 /**void ambulance(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, Sphere& sphere)
@@ -5641,427 +5878,340 @@ void sign_board(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.00f, 3.00f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
 
     // front choto part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.79f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.00f, 1.30f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
     // front choto part
-    //glBindTexture(GL_TEXTURE_2D, texture0);
+    //glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.25f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.50f, 2.30f, 4.00f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     //tilt part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.1f, 0.9f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.30f, 0.10f, 4.00f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(0.0f, 0.0f, 1.0f));
     model = rotateZMatrix * translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // red light
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.1f, 0.9f, 0.15f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.30f, 1.0f, 3.4f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
     // plus
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.97f, 0.83f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.5f, 1.0f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.8f, 0.95f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.2f, 0.5f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // lal danda
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.8f, 0.3f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(6.85f, 0.2f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // black danda
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.8f, 0.23f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(6.85f, 0.05f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.08f, 1.35f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(5.05f, 0.05f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.8f, 0.0f, -0.005f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(6.85f, 0.25f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // side windows
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.4f, 0.82f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.2f, 1.0f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(1.1f, 0.82f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.0f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // head lights
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.82f, 0.09f, 0.149f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.3f, 0.6f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.75f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.75f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "amber");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.82f, 0.09f, 1.55f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.3f, 0.6f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 0.75f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 0.75f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "amber");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // back windows
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.72f, 0.225f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.2f, 1.0f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.72f, 1.195f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.2f, 1.0f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     // back black danda
     ;
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.4f, 0.95f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.91f, 0.05f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.4f, 1.75f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.91f, 0.05f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.4f, 1.95f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.91f, 0.05f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.4f, 0.15f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.91f, 0.05f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.4f, 0.02f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 1.91f, 0.05f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.961f, 0.169f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "redLight");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
     //back handle
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.62f, 0.57f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 0.09f, 0.3f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.31f, 0.62f, 1.175f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 0.09f, 0.3f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
     //side drivers window
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.29f, 1.0f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.85f, 0.1f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.082f, 0.253f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 1.5f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.7f, 0.253f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.1f, 0.8f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.17f, 0.65f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.4f, 0.6f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.52f, 0.80f, .98f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "lightBlue");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    glBindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.17f, 0.5f, -0.015f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.05f, 4.1f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "solidBlack");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
 
 
     //////wheel
     //translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 0.0f, 0.7f));
     //rotateZMatrix = glm::rotate(identityMatrix, glm::radians(0.0f + mriRotateAngle), glm::vec3(1.0f, 0.0f, 0.0f));
     //scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.5f, 0.2f));
-    //ourShader.setMat4("model", moveMatrix* translateMatrix);
-    //ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    //ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    //ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    //ourShader.setFloat("material.shininess", 32.0f);
+    //ourShader.setMat4(modelLoc, moveMatrix* translateMatrix);
+    //ourShader.setVec4(materialAmbientLoc, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    //ourShader.setVec4(materialDiffuseLoc, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    //ourShader.setVec4(materialSpecularLoc, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
+    //ourShader.setFloat(materialShininessLoc, 32.0f);
 
     //sphere.drawSphere(ourShader);
 
@@ -6069,258 +6219,207 @@ void sign_board(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 
 }*/
 
-void computer(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void computer(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.1f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.50f, 1.00f, .10f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.175f, 0.05f, -0.01f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.20f, 0.80f, .05f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.43f, -0.07f, 0.02f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.15f, 0.35f, .05f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.37f, -0.1f, 0.01f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.35f, 0.1f, .25f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
 }
 
 
-void danda(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void danda(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
     //stick
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.3f, 2.0f, -0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
     //upor danda
 
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.3f, 2.75f, -0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.2f, 2.0f));
 
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 }
-void slide(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void slide(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last main part
-    glBindTexture(GL_TEXTURE_2D, texture6);
+    bindTexture(GL_TEXTURE_2D, tex("stairs"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.8f, 0.0f, -3.1f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(35.0f), glm::vec3(1.0f, 0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.50f, 0.30f, 10.00f));
     model = rotateZMatrix * translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 }
 
-void staircase(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void staircase(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //big part
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.38f, -0.5f, -0.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.00f, 5.04f, 0.80f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //upor part
-    glBindTexture(GL_TEXTURE_2D, texture6);
+    bindTexture(GL_TEXTURE_2D, tex("stairs"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.38f, 2.0f, -0.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.00f, 0.1f, 0.85f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
     //stick
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.38f, 2.0f, -0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
-    glBindTexture(GL_TEXTURE_2D, texture10);
+    bindTexture(GL_TEXTURE_2D, tex("stick"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.3f, 2.0f, -0.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.10f, 1.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "white");
+    drawCubeElements(ourShader);
 
 
     //upor danda
 
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.3f, 1.75f, -2.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.2f, 1.3f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(1.0f, 0.0f, 0.0f));
     model = rotateZMatrix * translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
-    glBindTexture(GL_TEXTURE_2D, texture5);
+    bindTexture(GL_TEXTURE_2D, tex("concrete"));
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.375f, 1.75f, -2.5f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.2f, 1.3f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(40.0f), glm::vec3(1.0f, 0.0f, 0.0f));
     model = rotateZMatrix * translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "black");
+    drawCubeElements(ourShader);
 
 
 }
-void baki_floor(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void baki_floor(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last 
-    glBindTexture(GL_TEXTURE_2D, texture1);
+    bindTexture(GL_TEXTURE_2D, tex("floor"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, 1.10f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(7.00f, 1.20f, 0.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 }
-void glass_window(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
+void glass_window(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color) {
 
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     //last 
-    glBindTexture(GL_TEXTURE_2D, texture3);
+    bindTexture(GL_TEXTURE_2D, tex("wood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.1f, 2.35f, -4.12f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(7.00f, 3.20f, 0.50f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //side 
-    glBindTexture(GL_TEXTURE_2D, texture3);
+    bindTexture(GL_TEXTURE_2D, tex("wood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.1f, 2.35f, -4.12f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.50f, 3.20f, 38.90f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
     //front
 
-    glBindTexture(GL_TEXTURE_2D, texture3);
+    bindTexture(GL_TEXTURE_2D, tex("wood"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, 2.35f, 14.92f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(7.0f, 3.20f, 0.70f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
+    drawCubeElements(ourShader);
 
 }
 // Function to generate a cylinder geometry (simplified version)
@@ -6357,48 +6456,42 @@ void generateCylinder(std::vector<float>& vertices, std::vector<unsigned int>& i
 }
 
 
-void pillers(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void pillers(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // Initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
     // Last main part
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
 
     // First pillar (upper part)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(0.0f, -0.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 9.2f, 1.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
     // Set material properties to white
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // White
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // White
-    ourShader.setVec4("material.specular", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f)); // White
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, "glossyWhite");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     // Second pillar (lower part)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-0.1f, -0.5f, -0.1f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.3f, 3.2f, 1.3f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
     // Set material properties to white
-    ourShader.setVec4("material.ambient", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // White
-    ourShader.setVec4("material.diffuse", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // White
-    ourShader.setVec4("material.specular", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f)); // White
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, "glossyWhite");
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 }
 
 
 
 
-void sperateWall(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void sperateWall(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -6406,30 +6499,24 @@ void sperateWall(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(10.7f, 1.25f + 0.45f, -13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.15f, 5.0f, 22.07f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
 
     translateMatrix = glm::translate(identityMatrix, glm::vec3(10.7f, 1.25f + 0.45f, -0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(.15f, 8.7f, 12.07f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
    
 }
 
-void Fan1(Shader ourShader, glm::mat4 moveMatrix)
+void Fan1(Shader& ourShader, glm::mat4 moveMatrix)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateToPivot, translateFromPivot, rotateYMatrix, scaleMatrix, model, moveModel;
@@ -6441,18 +6528,10 @@ void Fan1(Shader ourShader, glm::mat4 moveMatrix)
     //rotateYMatrix = glm::rotate(identityMatrix, glm::radians(rotateAngle_Y), glm::vec3(0.0f, 1.0f, 0.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 0.5f, 0.1f));
     model = moveModel * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.2f, 0.2f, 0.2f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-
-    if (isRotating)
-    {
-        rotateAngle_Y += fanSpeed;
-        rotateAngle_Y = fmod(rotateAngle_Y, 360);
-    }
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "charcoal");
+    drawCubeElements(ourShader);
+
 
 
 
@@ -6474,12 +6553,9 @@ void Fan1(Shader ourShader, glm::mat4 moveMatrix)
     model = moveModel * translateFromPivot * rotateYMatrix * translateToPivot * scaleMatrix;
     //model = moveModel * rotateYMatrix * scaleMatrix;
     //model =  translateFromPivot * rotateYMatrix * translateToPivot;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.2f, 1.0f, 0.2f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.2f, 1.0f, 0.2f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "paleGreen");
+    drawCubeElements(ourShader);
 
     //One hand
 
@@ -6496,12 +6572,9 @@ void Fan1(Shader ourShader, glm::mat4 moveMatrix)
     translateFromPivot = glm::translate(identityMatrix, glm::vec3(translateFromPivotOrg));
 
     model = moveModel * translateFromPivot * rotateYMatrix * translateToPivot * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.2f, 0.2f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.2f, 0.2f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "royalBlue");
+    drawCubeElements(ourShader);
 
     //Second hand
 
@@ -6518,17 +6591,14 @@ void Fan1(Shader ourShader, glm::mat4 moveMatrix)
     translateFromPivot = glm::translate(identityMatrix, glm::vec3(translateFromPivotOrg));
 
     model = moveModel * translateFromPivot * rotateYMatrix * translateToPivot * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.2f, 0.2f, 1.0f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.2f, 0.2f, 1.0f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "royalBlue");
+    drawCubeElements(ourShader);
 
 } 
 
 
-void carpet(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void carpet(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -6536,17 +6606,14 @@ void carpet(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(3.5f, 1.25f + 0.45f, -5.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(4.5f, 0.1f, 35.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", glm::vec4(0.1f, 0.1f, 0.1f, 0.5f));
-    ourShader.setFloat("material.shininess", 32.0f);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, glm::vec4(0.1f, 0.1f, 0.1f, 0.5f), 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 }
 
 
-void outside_boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void outside_boundary(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
@@ -6555,16 +6622,13 @@ void outside_boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
    
 
     //Left choto Side
-    glBindTexture(GL_TEXTURE_2D, texture2);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(9.4f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, color * 0.5f, 32.0f);
+    drawCubeElements(ourShader);
     //Left 
 
 
@@ -6573,273 +6637,246 @@ void outside_boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 10.0f, -37.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //Right Side
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-24.0f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //Right Wall
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(1.0f, 10.0f, -37.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //Back
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, -4.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(19.2f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, -4.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-21.2f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
 
     //Left Side Pillar
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(2.7f, -0.42f, 14.9f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 19.2f, 0.6f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color * 0.5f);
-    ourShader.setVec4("material.diffuse", color * 0.5f);
-    ourShader.setVec4("material.specular", color * 0.5f * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color * 0.5f, color * 0.5f, color * 0.5f * 0.5f, 32.0f);
+    drawCubeElements(ourShader);
 
     //Right Side Pillar
     translateMatrix = glm::translate(identityMatrix, glm::vec3(5.8f, -0.42f, 14.9f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.6f, 19.2f, 0.6f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
 
-    ourShader.setVec4("material.ambient", color * 0.5f);
-    ourShader.setVec4("material.diffuse", color * 0.5f);
-    ourShader.setVec4("material.specular", color * 0.5f * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color * 0.5f, color * 0.5f, color * 0.5f * 0.5f, 32.0f);
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    drawCubeElements(ourShader);
 
     
 
 }
-void Boundary(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void Boundary(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
 
     //Left Side
-    glBindTexture(GL_TEXTURE_2D, texture2);
+    bindTexture(GL_TEXTURE_2D, tex("wall"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(17.2f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color, color, color * 0.5f, 32.0f);
+    drawCubeElements(ourShader);
     //Left Wall
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 10.0f, -37.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //Right Side
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-15.4f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //Right Wall
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-0.2f, 10.0f, -37.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //Back
     translateMatrix = glm::translate(identityMatrix, glm::vec3(-2.0f, -0.42f, -4.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(19.2f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(18.15f, -0.42f, -4.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(-21.2f, 10.0f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
 
     
 
 }
 
-void GuardRoom(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture = texture0)
+void GuardRoom(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture = tex("transparent"))
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model;
 
     //roof
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.35f, 0.95f, 12.86f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 0.25f, 4.3f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color * 0.5f);
-    ourShader.setVec4("material.diffuse", color * 0.5f);
-    ourShader.setVec4("material.specular", color * 0.5f * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color * 0.5f, color * 0.5f, color * 0.5f * 0.5f, 32.0f);
+    drawCubeElements(ourShader);
 
     //back side
-    glBindTexture(GL_TEXTURE_2D, texture);
+    bindTexture(GL_TEXTURE_2D, texture);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.4f, -0.42f, 13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 2.75f, 3.80f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //right side
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, color * 0.5f, 32.0f);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.5f, -0.42f, 13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.2f, 2.75f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //left side
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.5f, -0.42f, 14.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.2f, 2.75f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //font side
     //1
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, -0.42f, 13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 2.75f, 0.6f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //2
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, -0.42f, 13.8f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 2.75f, 0.8f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //3
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, -0.42f, 13.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 1.2f, 1.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //4
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, 0.6f, 13.25f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.9f, 1.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
     //5
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.5f, 0.7f, 14.1f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 0.6f, 1.5f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //floor
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.401f, -0.42f, 13.001f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(2.38f, 0.1f, 3.7f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color * 0.1f);
-    ourShader.setVec4("material.diffuse", color * 0.1f);
-    ourShader.setVec4("material.specular", color * 0.5f * 0.1f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color * 0.1f, color * 0.1f, color * 0.5f * 0.1f, 32.0f);
+    drawCubeElements(ourShader);
 
 
 
 }
 
-void Shop(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture = texture0)
+void Shop(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color, unsigned int texture = tex("transparent"))
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
 
 
     //roof
-    glBindTexture(GL_TEXTURE_2D, texture0);
+    bindTexture(GL_TEXTURE_2D, tex("transparent"));
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.7f, 0.95f, 12.86f));
     rotateZMatrix = glm::rotate(identityMatrix, glm::radians(-4.0f), glm::vec3(0.0f, 0.0f, 1.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.8f, 0.29f, 6.0f));
     model = translateMatrix * rotateZMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", color * 0.5f);
-    ourShader.setVec4("material.diffuse", color * 0.5f);
-    ourShader.setVec4("material.specular", color * 0.5f * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, color * 0.5f, color * 0.5f, color * 0.5f * 0.5f, 32.0f);
+    drawCubeElements(ourShader);
 
     //back side
-    glBindTexture(GL_TEXTURE_2D, texture);
+    bindTexture(GL_TEXTURE_2D, texture);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(8.4f, -0.42f, 13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 2.75f, 5.5f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //right side
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, color * 0.5f, 32.0f);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.99f, -0.419f, 12.99f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.75f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //left side
-    ourShader.setVec4("material.ambient", color);
-    ourShader.setVec4("material.diffuse", color);
-    ourShader.setVec4("material.specular", color * 0.5f);
-    ourShader.setFloat("material.shininess", 32.0f);
+    setMaterial(ourShader, color, color, color * 0.5f, 32.0f);
     translateMatrix = glm::translate(identityMatrix, glm::vec3(6.99f, -0.419f, 15.651f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(3.0f, 2.75f, 0.2f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     //front side
     translateMatrix = glm::translate(identityMatrix, glm::vec3(7.0f, -0.42f, 13.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.2f, 1.2f, 4.0f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    drawCubeElements(ourShader);
 
     
 
 }
 
-void Gate(Shader ourShader, glm::mat4 moveMatrix, glm::vec4 color)
+void Gate(Shader& ourShader, glm::mat4 moveMatrix, glm::vec4 color)
 {
 
 
 }
 
-void LampPost(Shader ourShader, glm::mat4 moveMatrix)
+void LampPost(Shader& ourShader, glm::mat4 moveMatrix)
 {
     glm::mat4 identityMatrix = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
     glm::mat4 translateMatrix, scaleMatrix, model, rotateZMatrix;
@@ -6848,21 +6885,15 @@ void LampPost(Shader ourShader, glm::mat4 moveMatrix)
     translateMatrix = glm::translate(identityMatrix, glm::vec3(8.01f, -0.42f, 15.0f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.7f, 0.3f, 0.7f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.3f, 0.3f, 0.3f, 1.0f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "darkGrey");
+    drawCubeElements(ourShader);
 
     //pillar
     translateMatrix = glm::translate(identityMatrix, glm::vec3(8.17f, -0.42f, 15.15f));
     scaleMatrix = glm::scale(identityMatrix, glm::vec3(0.1f, 3.5f, 0.1f));
     model = translateMatrix * scaleMatrix;
-    ourShader.setMat4("model", moveMatrix * model);
-    ourShader.setVec4("material.ambient", glm::vec4(0.2f, 0.2f, 0.2f, 1.0f));
-    ourShader.setVec4("material.diffuse", glm::vec4(0.3f, 0.4f, 0.3f, 1.0f));
-    ourShader.setVec4("material.specular", glm::vec4(0.3f, 0.4f, 0.3f, 1.0f));
-    ourShader.setFloat("material.shininess", 32.0f);
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    ourShader.setMat4(modelLoc, moveMatrix * model);
+    setMaterial(ourShader, "moss");
+    drawCubeElements(ourShader);
 }
\ No newline at end of file
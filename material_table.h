@@ -0,0 +1,145 @@
+#ifndef material_table_h
+#define material_table_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include "shader.h"
+
+// std140 image of the Material struct in fragmentShader.fs
+struct MaterialBlock {
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+    float shininess;
+    float padding[3];
+};
+
+// Every material the scene draws with, kept in the Materials uniform block of
+// fragmentShader.fs. A draw selects its material with the single integer
+// materialIndex instead of four material uniforms.
+//
+// define() gives a material a name when the scene is loaded, so the colors
+// written out at the draws become one entry each, however often they repeat.
+// Materials worked out from a color at draw time go through intern(), which
+// finds the entry with the same values or adds one. New entries reach the
+// buffer with the next upload(), which does nothing when none were added.
+//
+// Index 0 is the all zero material a draw got before any material was set;
+// unknown names and materials past maxMaterials fall back to it, reported once.
+class MaterialTable {
+public:
+    // 16 KB, the smallest GL_MAX_UNIFORM_BLOCK_SIZE 3.3 allows
+    static const int maxMaterials = 256;
+    static const GLuint binding = 1;
+
+    MaterialTable()
+    {
+        count = 1;
+    }
+
+    ~MaterialTable()
+    {
+        if (materialUBO != 0)
+            glDeleteBuffers(1, &materialUBO);
+    }
+
+    MaterialTable(const MaterialTable&) = delete;
+    MaterialTable& operator=(const MaterialTable&) = delete;
+
+    // point the shader's Materials block at our binding, creating the buffer
+    // the first time
+    void attach(const Shader& shader)
+    {
+        if (materialUBO == 0)
+        {
+            glGenBuffers(1, &materialUBO);
+            glBindBuffer(GL_UNIFORM_BUFFER, materialUBO);
+            glBufferData(GL_UNIFORM_BUFFER, sizeof(materials), NULL, GL_STATIC_DRAW);
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+            glBindBufferBase(GL_UNIFORM_BUFFER, binding, materialUBO);
+            uploaded = 0;
+        }
+        shader.bindUniformBlock("Materials", binding);
+    }
+
+    // names a material; a name defined again moves to the new values
+    int define(const std::string& name, const glm::vec4& ambient, const glm::vec4& diffuse, const glm::vec4& specular, float shininess)
+    {
+        int index = intern(ambient, diffuse, specular, shininess);
+        names[name] = index;
+        return index;
+    }
+
+    int find(const char* name)
+    {
+        auto named = names.find(name);
+        if (named != names.end())
+            return named->second;
+        std::cout << "Unknown material \"" << name << "\", drawing it black" << std::endl;
+        names[name] = 0;
+        return 0;
+    }
+
+    int intern(const glm::vec4& ambient, const glm::vec4& diffuse, const glm::vec4& specular, float shininess)
+    {
+        MaterialBlock material{};
+        material.ambient = ambient;
+        material.diffuse = diffuse;
+        material.specular = specular;
+        material.shininess = shininess;
+        // a color is usually drawn several times in a row
+        if (std::memcmp(&materials[last], &material, sizeof(material)) == 0)
+            return last;
+        for (int i = 0; i < count; i++)
+            if (std::memcmp(&materials[i], &material, sizeof(material)) == 0)
+                return last = i;
+        if (count == maxMaterials)
+        {
+            if (!reportedFull)
+                std::cout << "More than " << maxMaterials << " materials, drawing the rest black" << std::endl;
+            reportedFull = true;
+            return 0;
+        }
+        materials[count] = material;
+        return last = count++;
+    }
+
+    // sends the materials added since the last upload
+    void upload()
+    {
+        if (uploaded == count || materialUBO == 0)
+            return;
+        glBindBuffer(GL_UNIFORM_BUFFER, materialUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, uploaded * sizeof(MaterialBlock), (count - uploaded) * sizeof(MaterialBlock), &materials[uploaded]);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        uploaded = count;
+    }
+
+    int materialCount() const
+    {
+        return count;
+    }
+
+    int nameCount() const
+    {
+        return (int)names.size();
+    }
+
+private:
+    MaterialBlock materials[maxMaterials]{};
+    int count = 0;
+    int uploaded = 0;
+    int last = 0;
+    bool reportedFull = false;
+    std::map<std::string, int, std::less<>> names;
+    GLuint materialUBO = 0;
+};
+
+static_assert(sizeof(MaterialBlock) == 64, "Material std140 size");
+
+#endif /* material_table_h */
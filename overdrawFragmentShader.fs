@@ -0,0 +1,22 @@
+#version 330 core
+// Overdraw heatmap (overdraw_view.h): black where nothing was drawn, blue for
+// one fragment, then green, yellow and red at maxOverdraw fragments or more
+
+out vec4 FragColor;
+
+uniform sampler2D overdraw;
+uniform float maxOverdraw;
+
+void main()
+{
+    float count = texelFetch(overdraw, ivec2(gl_FragCoord.xy), 0).r;
+    if(count < 0.5f)
+    {
+        FragColor = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        return;
+    }
+    vec3 ramp[4] = vec3[4](vec3(0.0f, 0.2f, 1.0f), vec3(0.0f, 0.9f, 0.2f), vec3(1.0f, 0.9f, 0.0f), vec3(1.0f, 0.0f, 0.0f));
+    float heat = 3.0f * clamp((count - 1.0f) / (maxOverdraw - 1.0f), 0.0f, 1.0f);
+    int step = min(int(heat), 2);
+    FragColor = vec4(mix(ramp[step], ramp[step + 1], heat - float(step)), 1.0f);
+}
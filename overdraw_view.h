@@ -0,0 +1,148 @@
+#ifndef overdraw_view_h
+#define overdraw_view_h
+
+#include <glad/glad.h>
+#include <iostream>
+#include <vector>
+#include "shader.h"
+#include "gl_handle.h"
+#include "render_state.h"
+
+// Debug view of how many fragments each pixel gets. Between begin() and show()
+// the frame draws into a count buffer of its own with additive blending while
+// the shaders' overdrawPass makes every fragment write 1, so a pixel ends up
+// holding how many fragments passed the depth test there, which is how many
+// the forward shader would have lit. show() draws the counts over the frame
+// as a heatmap with overdrawFragmentShader.fs: black for nothing drawn, then
+// blue for one fragment through green and yellow to red at maxOverdraw.
+//
+// Drawing near things first or a depth pre-pass shows up as less red;
+// average() puts a number on it.
+class OverdrawView {
+public:
+    static constexpr float maxOverdraw = 8.0f;
+    // after the G-buffer's units (deferred_renderer.h)
+    static const int unit = 10;
+
+    OverdrawView()
+    {
+        glGenFramebuffers(1, &countBuffer);
+        glGenTextures(1, &countTexture);
+        glGenRenderbuffers(1, &depthBuffer);
+        glGenVertexArrays(1, &screenVAO);
+    }
+
+    ~OverdrawView()
+    {
+        glDeleteFramebuffers(1, &countBuffer);
+        deleteTextures(1, &countTexture);
+        glDeleteRenderbuffers(1, &depthBuffer);
+        deleteVertexArrays(1, &screenVAO);
+    }
+
+    OverdrawView(const OverdrawView&) = delete;
+    OverdrawView& operator=(const OverdrawView&) = delete;
+
+    // points the heatmap shader's sampler at the counts; shader must be in use
+    void attach(const Shader& shader) const
+    {
+        shader.setInt("overdraw", unit);
+        shader.setFloat("maxOverdraw", maxOverdraw);
+    }
+
+    // draws that follow are counted instead of shown; false if the driver
+    // cannot draw into the count buffer
+    bool begin(int width, int height)
+    {
+        if (width != this->width || height != this->height)
+            resize(width, height);
+        if (!complete)
+            return false;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        glBindFramebuffer(GL_FRAMEBUFFER, countBuffer);
+        const GLfloat zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        const GLfloat farthest = 1.0f;
+        glClearBufferfv(GL_COLOR, 0, zero);
+        glClearBufferfv(GL_DEPTH, 0, &farthest);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE);
+        return true;
+    }
+
+    // the counts as a heatmap over the framebuffer that was bound at begin();
+    // the heatmap shader must be in use
+    void show()
+    {
+        glDisable(GL_BLEND);
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        activeTexture(GL_TEXTURE0 + unit);
+        bindTexture(GL_TEXTURE_2D, countTexture);
+        activeTexture(GL_TEXTURE0);
+        glDisable(GL_DEPTH_TEST);
+        bindVertexArray(screenVAO);
+        drawArrays(GL_TRIANGLES, 0, 3);
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    // fragments per pixel that got any, read back from the last counted
+    // frame; this waits for the frame to finish, so it is for the title and
+    // the benchmark summary rather than every frame
+    float average()
+    {
+        if (!complete)
+            return 0.0f;
+        counts.resize((size_t)width * height);
+        GLint previous = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, countBuffer);
+        glReadPixels(0, 0, width, height, GL_RED, GL_FLOAT, counts.data());
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, previous);
+        double fragments = 0.0;
+        size_t covered = 0;
+        for (float count : counts)
+            if (count > 0.0f)
+            {
+                fragments += count;
+                covered++;
+            }
+        return covered > 0 ? (float)(fragments / covered) : 0.0f;
+    }
+
+private:
+    GLuint countBuffer = 0;
+    GLuint countTexture = 0;
+    GLuint depthBuffer = 0;
+    GLHandle screenVAO;
+    GLint target = 0;
+    int width = 0;
+    int height = 0;
+    bool complete = false;
+    std::vector<float> counts;
+
+    void resize(int width, int height)
+    {
+        this->width = width;
+        this->height = height;
+        GLint previous = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+        glBindFramebuffer(GL_FRAMEBUFFER, countBuffer);
+        // half floats blend in GL 3.3 and count exactly far past maxOverdraw
+        activeTexture(GL_TEXTURE0 + unit);
+        bindTexture(GL_TEXTURE_2D, countTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R16F, width, height, 0, GL_RED, GL_FLOAT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        activeTexture(GL_TEXTURE0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, countTexture, 0);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        // stencil for the depth pre-pass
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete)
+            std::cout << "Overdraw buffer of " << width << "x" << height << " is incomplete, overdraw view off" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    }
+};
+
+#endif /* overdraw_view_h */
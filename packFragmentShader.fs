@@ -0,0 +1,22 @@
+#version 330 core
+// Copies a texture into a texture array layer of another size, averaging
+// taps x taps samples per layer texel when the source is larger
+
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+uniform sampler2D source;
+uniform vec2 layerSize;
+uniform vec2 taps;
+
+void main()
+{
+    vec2 texel = 1.0f / layerSize;
+    vec2 corner = TexCoord - 0.5f * texel;
+    vec4 sum = vec4(0.0f);
+    for (int y = 0; y < int(taps.y); y++)
+        for (int x = 0; x < int(taps.x); x++)
+            sum += textureLod(source, corner + (vec2(x, y) + 0.5f) / taps * texel, 0.0f);
+    FragColor = sum / (taps.x * taps.y);
+}
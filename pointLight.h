@@ -5,6 +5,18 @@
 #include <glm/glm.hpp>
 #include "shader.h"
 
+// what fragmentShader.fs gets of a PointLight, LightClusters packs it into the light buffer
+struct PointLightBlock {
+    glm::vec4 position;
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+    float Kc;
+    float Kl;
+    float Kq;
+    float padding;
+};
+
 class PointLight {
 public:
     glm::vec3 position;
@@ -30,16 +42,15 @@ public:
         lightNumber = num;
     }
 
-    void setUpLight(Shader& lightingShader)
+    void setUpLight(PointLightBlock& block) const
     {
-        lightingShader.use();
-        lightingShader.setVec4("pointLight.ambient", ambient * ambientOn * isOn);
-        lightingShader.setVec4("pointLight.diffuse", diffuse * diffuseOn * isOn);
-        lightingShader.setVec4("pointLight.specular", specular * specularOn * isOn);
-        lightingShader.setVec3("pointLight.position", position);
-        lightingShader.setFloat("pointLight.Kc", Kc);
-        lightingShader.setFloat("pointLight.Kl", Kl);
-        lightingShader.setFloat("pointLight.Kq", Kq);
+        block.ambient = ambient * ambientOn * isOn;
+        block.diffuse = diffuse * diffuseOn * isOn;
+        block.specular = specular * specularOn * isOn;
+        block.position = glm::vec4(position, 1.0f);
+        block.Kc = Kc;
+        block.Kl = Kl;
+        block.Kq = Kq;
     }
 
     void turnOff()
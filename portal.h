@@ -0,0 +1,196 @@
+#ifndef portal_h
+#define portal_h
+
+#include <glm/glm.hpp>
+#include <vector>
+#include "frustum.h"
+
+// Cells and portals of an indoor scene. Every room is a box (a cell), every
+// opening between two rooms is a flat box (a portal) that may be closed.
+// update() starts in the cell holding the eye and walks through open portals,
+// narrowing the screen rectangle that can still be seen at every step; a cell
+// is visible when it is reached with some of the screen left.
+//
+// One cell can be marked as the exterior. It is everything outside the box
+// given to setExterior(), so walls on that box count as part of it.
+class CellGraph {
+public:
+    typedef bool (*PortalState)();
+
+    int addCell(const BoundingBox& box)
+    {
+        cells.push_back({ box, false, false });
+        return (int)cells.size() - 1;
+    }
+
+    int setExterior(const BoundingBox& building)
+    {
+        this->building = building;
+        cells.push_back({ building, true, false });
+        return (int)cells.size() - 1;
+    }
+
+    // isOpen is asked once per update, NULL means the opening is always open
+    void addPortal(int cellA, int cellB, const BoundingBox& opening, PortalState isOpen = NULL)
+    {
+        portals.push_back({ cellA, cellB, opening, isOpen, true });
+    }
+
+    void update(const glm::vec3& eye, const glm::mat4& viewProjection)
+    {
+        this->viewProjection = viewProjection;
+        for (Portal& portal : portals)
+            portal.open = portal.isOpen == NULL || portal.isOpen();
+        for (Cell& cell : cells)
+            cell.visible = false;
+        visibleCount = 0;
+
+        int start = cellAt(eye);
+        if (start < 0)
+        {
+            // somewhere the graph does not describe, draw everything
+            for (Cell& cell : cells)
+                cell.visible = true;
+            visibleCount = (int)cells.size();
+            return;
+        }
+        visit(start, -1, glm::vec2(-1.0f), glm::vec2(1.0f), 0);
+    }
+
+    // true when box touches a cell that can be seen this frame
+    bool intersects(const BoundingBox& box) const
+    {
+        if (cells.empty())
+            return true;
+        for (const Cell& cell : cells)
+            if (cell.visible && overlaps(cell, box))
+                return true;
+        return false;
+    }
+
+    int cellCount() const
+    {
+        return (int)cells.size();
+    }
+
+    const BoundingBox& cellBox(int cell) const
+    {
+        return cells[cell].box;
+    }
+
+    bool isExterior(int cell) const
+    {
+        return cells[cell].exterior;
+    }
+
+    int visibleCells() const
+    {
+        return visibleCount;
+    }
+
+private:
+    struct Cell {
+        BoundingBox box;
+        bool exterior;
+        bool visible;
+    };
+
+    struct Portal {
+        int cellA;
+        int cellB;
+        BoundingBox opening;
+        PortalState isOpen;
+        bool open;
+    };
+
+    std::vector<Cell> cells;
+    std::vector<Portal> portals;
+    BoundingBox building;
+    glm::mat4 viewProjection;
+    int visibleCount = 0;
+
+    static bool inside(const BoundingBox& box, const glm::vec3& point)
+    {
+        return point.x >= box.min.x && point.x <= box.max.x && point.y >= box.min.y && point.y <= box.max.y &&
+            point.z >= box.min.z && point.z <= box.max.z;
+    }
+
+    int cellAt(const glm::vec3& point) const
+    {
+        int exterior = -1;
+        for (size_t i = 0; i < cells.size(); i++)
+        {
+            if (cells[i].exterior)
+                exterior = (int)i;
+            else if (inside(cells[i].box, point))
+                return (int)i;
+        }
+        if (exterior >= 0 && !inside(building, point))
+            return exterior;
+        return -1;
+    }
+
+    bool overlaps(const Cell& cell, const BoundingBox& box) const
+    {
+        if (cell.exterior)
+        {
+            // anything not strictly inside the building reaches outside
+            const float wall = 0.05f;
+            return box.min.x < building.min.x + wall || box.min.y < building.min.y + wall || box.min.z < building.min.z + wall ||
+                box.max.x > building.max.x - wall || box.max.y > building.max.y - wall || box.max.z > building.max.z - wall;
+        }
+        return box.min.x <= cell.box.max.x && box.max.x >= cell.box.min.x && box.min.y <= cell.box.max.y &&
+            box.max.y >= cell.box.min.y && box.min.z <= cell.box.max.z && box.max.z >= cell.box.min.z;
+    }
+
+    // screen rectangle of an opening clipped to [low, high]; false if nothing is
+    // left. Openings reaching behind the eye keep the whole rectangle.
+    bool clipToOpening(const BoundingBox& opening, glm::vec2& low, glm::vec2& high) const
+    {
+        glm::vec2 openingLow = glm::vec2(1.0f);
+        glm::vec2 openingHigh = glm::vec2(-1.0f);
+        for (int corner = 0; corner < 8; corner++)
+        {
+            glm::vec3 point = glm::vec3(corner & 1 ? opening.max.x : opening.min.x,
+                corner & 2 ? opening.max.y : opening.min.y,
+                corner & 4 ? opening.max.z : opening.min.z);
+            glm::vec4 clip = viewProjection * glm::vec4(point, 1.0f);
+            if (clip.w <= 0.01f)
+                return true;
+            glm::vec2 ndc = glm::vec2(clip.x, clip.y) * (1.0f / clip.w);
+            openingLow = glm::min(openingLow, ndc);
+            openingHigh = glm::max(openingHigh, ndc);
+        }
+        low = glm::max(low, openingLow);
+        high = glm::min(high, openingHigh);
+        return low.x < high.x && low.y < high.y;
+    }
+
+    void visit(int cell, int throughPortal, glm::vec2 low, glm::vec2 high, int depth)
+    {
+        if (!cells[cell].visible)
+        {
+            cells[cell].visible = true;
+            visibleCount++;
+        }
+        // a room is never more than a handful of openings away
+        if (depth == 8)
+            return;
+
+        for (size_t i = 0; i < portals.size(); i++)
+        {
+            const Portal& portal = portals[i];
+            if (!portal.open || (int)i == throughPortal)
+                continue;
+            int next = portal.cellA == cell ? portal.cellB : portal.cellB == cell ? portal.cellA : -1;
+            if (next < 0)
+                continue;
+            glm::vec2 nextLow = low;
+            glm::vec2 nextHigh = high;
+            if (clipToOpening(portal.opening, nextLow, nextHigh))
+                visit(next, (int)i, nextLow, nextHigh, depth + 1);
+        }
+    }
+};
+
+#endif /* portal_h */
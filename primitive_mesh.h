@@ -0,0 +1,136 @@
+#ifndef primitive_mesh_h
+#define primitive_mesh_h
+
+#include <glad/glad.h>
+#include <vector>
+#include <map>
+#include "render_state.h"
+#include "gl_handle.h"
+#include "frustum.h"
+
+// what a primitive was generated from; equal keys give byte-identical meshes
+struct PrimitiveKey {
+    enum Type { CYLINDER, SPHERE, HALF_SPHERE, CAPSULE, PIPE_SEGMENT };
+
+    Type type;
+    int sectors;
+    int stacks;
+    float radius;
+    float arcLength;
+
+    bool operator<(const PrimitiveKey& other) const
+    {
+        if (type != other.type) return type < other.type;
+        if (sectors != other.sectors) return sectors < other.sectors;
+        if (stacks != other.stacks) return stacks < other.stacks;
+        if (radius != other.radius) return radius < other.radius;
+        return arcLength < other.arcLength;
+    }
+};
+
+// where one primitive lives inside the shared arena
+struct PrimitiveMesh {
+    GLint baseVertex = 0;
+    unsigned int firstIndex = 0;
+    GLsizei indexCount = 0;
+    BoundingBox bounds;     // in the primitive's own space
+};
+
+// One VAO/VBO/EBO shared by every Cylinder, Wheel, Capsule, HalfSphere and
+// CurvedPipeSegment. acquire() runs the generator only the first time a key is
+// seen and appends the result to the arena; every later object with the same
+// key gets the same handle. Indices stay local to their mesh and are drawn
+// with glDrawElementsBaseVertex, so the arena grows by appending only.
+//
+// Vertices are position, normal, uv (8 floats), like the rest of the scene.
+class PrimitiveMeshRegistry {
+public:
+    typedef void (*Generator)(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices);
+
+    static PrimitiveMeshRegistry& shared()
+    {
+        static PrimitiveMeshRegistry registry;
+        return registry;
+    }
+
+    PrimitiveMesh acquire(const PrimitiveKey& key, Generator generate)
+    {
+        std::map<PrimitiveKey, PrimitiveMesh>::const_iterator it = meshes.find(key);
+        if (it != meshes.end())
+            return it->second;
+
+        std::vector<float> vertices;
+        std::vector<unsigned int> indices;
+        generate(key, vertices, indices);
+
+        PrimitiveMesh mesh;
+        mesh.baseVertex = (GLint)(arenaVertices.size() / 8);
+        mesh.firstIndex = (unsigned int)arenaIndices.size();
+        mesh.indexCount = (GLsizei)indices.size();
+        for (size_t i = 0; i + 2 < vertices.size(); i += 8)
+            mesh.bounds.expand(glm::vec3(vertices[i], vertices[i + 1], vertices[i + 2]));
+        arenaVertices.insert(arenaVertices.end(), vertices.begin(), vertices.end());
+        arenaIndices.insert(arenaIndices.end(), indices.begin(), indices.end());
+        meshes[key] = mesh;
+        dirty = true;
+        return mesh;
+    }
+
+    void draw(const PrimitiveMesh& mesh)
+    {
+        if (dirty)
+            upload();
+        bindVertexArray(arenaVAO);
+        drawElementsBaseVertex(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, (void*)(mesh.firstIndex * sizeof(unsigned int)), mesh.baseVertex);
+    }
+
+    int meshCount() const
+    {
+        return (int)meshes.size();
+    }
+
+    size_t arenaBytes() const
+    {
+        return arenaVertices.size() * sizeof(float) + arenaIndices.size() * sizeof(unsigned int);
+    }
+
+private:
+    std::map<PrimitiveKey, PrimitiveMesh> meshes;
+    std::vector<float> arenaVertices;
+    std::vector<unsigned int> arenaIndices;
+    GLHandle arenaVAO;
+    GLHandle arenaVBO;
+    GLHandle arenaEBO;
+    bool dirty = false;
+
+    PrimitiveMeshRegistry() {}
+    PrimitiveMeshRegistry(const PrimitiveMeshRegistry&) = delete;
+    PrimitiveMeshRegistry& operator=(const PrimitiveMeshRegistry&) = delete;
+
+    // the GL buffers are (re)filled lazily so objects can be built in any
+    // order during startup, in practice this happens once before the first draw
+    void upload()
+    {
+        if (arenaVAO == 0)
+        {
+            glGenVertexArrays(1, &arenaVAO);
+            glGenBuffers(1, &arenaVBO);
+            glGenBuffers(1, &arenaEBO);
+        }
+        bindVertexArray(arenaVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, arenaVBO);
+        glBufferData(GL_ARRAY_BUFFER, arenaVertices.size() * sizeof(float), arenaVertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, arenaEBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, arenaIndices.size() * sizeof(unsigned int), arenaIndices.data(), GL_STATIC_DRAW);
+
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+        dirty = false;
+    }
+};
+
+#endif /* primitive_mesh_h */
@@ -0,0 +1,309 @@
+#ifndef render_state_h
+#define render_state_h
+
+#include <glad/glad.h>
+#include <cstring>
+#include <vector>
+#include <map>
+
+// Shadow copy of the GL state the scene code keeps changing: current program,
+// VAO, active texture unit, the 2D texture on each unit and the last value
+// written to every uniform location of every program. Calls that would not
+// change anything are dropped before they reach the driver and counted, so
+// the window title can show how much was saved per frame.
+//
+// All binds in the drawing code go through the free functions at the bottom
+// of this file; a raw glBindTexture/glBindVertexArray/glUseProgram would leave
+// the shadow copy stale. Draws go through them too, only to be counted.
+
+// told about every draw, see RenderState::setDrawListener()
+class DrawListener {
+public:
+    virtual ~DrawListener() {}
+    // texture is what unit 0 holds for the draw
+    virtual void drawn(GLuint texture) = 0;
+};
+
+class RenderState {
+public:
+    struct Counters {
+        int programIssued = 0, programElided = 0;
+        int vertexArrayIssued = 0, vertexArrayElided = 0;
+        int textureIssued = 0, textureElided = 0;
+        int uniformIssued = 0, uniformElided = 0;
+        int drawCalls = 0;
+        long long triangles = 0;
+
+        int issued() const
+        {
+            return programIssued + vertexArrayIssued + textureIssued + uniformIssued;
+        }
+        int elided() const
+        {
+            return programElided + vertexArrayElided + textureElided + uniformElided;
+        }
+    };
+
+    // kind of glUniform* call a cached value came from, so that e.g. a vec3
+    // write never hides a later vec4 write of the same floats
+    enum UniformKind { UNIFORM_INT, UNIFORM_FLOAT, UNIFORM_VEC2, UNIFORM_VEC3, UNIFORM_VEC4, UNIFORM_MAT2, UNIFORM_MAT3, UNIFORM_MAT4 };
+
+    static RenderState& current()
+    {
+        static RenderState state;
+        return state;
+    }
+
+    void useProgram(GLuint program)
+    {
+        if (program == boundProgram)
+        {
+            counters.programElided++;
+            return;
+        }
+        glUseProgram(program);
+        boundProgram = program;
+        programValues = &uniformValues[program];
+        counters.programIssued++;
+    }
+
+    void bindVertexArray(GLuint vertexArray)
+    {
+        if (vertexArray == boundVertexArray)
+        {
+            counters.vertexArrayElided++;
+            return;
+        }
+        glBindVertexArray(vertexArray);
+        boundVertexArray = vertexArray;
+        counters.vertexArrayIssued++;
+    }
+
+    void activeTexture(GLenum unit)
+    {
+        // only selects where the next bindTexture goes, so it is not counted
+        if (unit == activeUnit)
+            return;
+        glActiveTexture(unit);
+        activeUnit = unit;
+    }
+
+    void bindTexture(GLenum target, GLuint texture)
+    {
+        unsigned int unit = activeUnit - GL_TEXTURE0;
+        if (target != GL_TEXTURE_2D || unit >= maxUnits)
+        {
+            glBindTexture(target, texture);
+            counters.textureIssued++;
+            return;
+        }
+        if (boundTexture2D[unit] == texture)
+        {
+            counters.textureElided++;
+            return;
+        }
+        glBindTexture(target, texture);
+        boundTexture2D[unit] = texture;
+        counters.textureIssued++;
+    }
+
+    // true when the uniform at location of the current program does not
+    // already hold value (at most a mat4), which then becomes its new value
+    bool uniformChanged(GLint location, UniformKind kind, const void* value, size_t bytes)
+    {
+        // -1 is a name the program does not have, glUniform would ignore it;
+        // not a repeated value, so it is not counted as elided either
+        if (location < 0)
+            return false;
+
+        std::vector<UniformValue>& values = *programValues;
+        if ((size_t)location >= values.size())
+            values.resize(location + 1);
+        UniformValue& cached = values[location];
+        if (cached.valid && cached.kind == kind && std::memcmp(cached.data, value, bytes) == 0)
+        {
+            counters.uniformElided++;
+            return false;
+        }
+        cached.valid = true;
+        cached.kind = kind;
+        std::memcpy(cached.data, value, bytes);
+        counters.uniformIssued++;
+        return true;
+    }
+
+    // last value written to location of the current program, NULL if none
+    // was written through the cache (or the location does not exist)
+    const float* cachedUniform(GLint location) const
+    {
+        if (location < 0 || (size_t)location >= programValues->size() || !(*programValues)[location].valid)
+            return NULL;
+        return (*programValues)[location].data;
+    }
+
+    // NULL stops the notifications
+    void setDrawListener(DrawListener* listener)
+    {
+        drawListener = listener;
+    }
+
+    DrawListener* currentDrawListener() const
+    {
+        return drawListener;
+    }
+
+    // 2D texture on unit (GL_TEXTURE0 + unit) as far as the shadow copy knows
+    GLuint boundTexture(unsigned int unit) const
+    {
+        return unit < maxUnits ? boundTexture2D[unit] : 0;
+    }
+
+    // one draw call of count indices or vertices, repeated for every instance
+    void countDraw(GLenum mode, GLsizei count, GLsizei instances)
+    {
+        if (drawListener != NULL)
+            drawListener->drawn(boundTexture2D[0]);
+        counters.drawCalls++;
+        if (mode == GL_TRIANGLES)
+            counters.triangles += (long long)(count / 3) * instances;
+        else if ((mode == GL_TRIANGLE_FAN || mode == GL_TRIANGLE_STRIP) && count > 2)
+            counters.triangles += (long long)(count - 2) * instances;
+    }
+
+    // GL silently unbinds deleted objects, the shadow copy has to follow
+    void forgetVertexArray(GLuint vertexArray)
+    {
+        if (vertexArray == boundVertexArray)
+            boundVertexArray = 0;
+    }
+
+    void forgetTexture(GLuint texture)
+    {
+        for (unsigned int unit = 0; unit < maxUnits; unit++)
+            if (boundTexture2D[unit] == texture)
+                boundTexture2D[unit] = 0;
+    }
+
+    // a program made later can get the same ID, it must not find these values
+    void forgetProgram(GLuint program)
+    {
+        if (program == boundProgram)
+        {
+            boundProgram = 0;
+            programValues = &uniformValues[0];
+        }
+        if (program != 0)
+            uniformValues.erase(program);
+    }
+
+    const Counters& frameCounters() const
+    {
+        return counters;
+    }
+
+    void resetCounters()
+    {
+        counters = Counters();
+    }
+
+private:
+    static const unsigned int maxUnits = 16;
+
+    struct UniformValue {
+        bool valid = false;
+        UniformKind kind = UNIFORM_INT;
+        float data[16];
+    };
+
+    GLuint boundProgram = 0;
+    GLuint boundVertexArray = 0;
+    GLenum activeUnit = GL_TEXTURE0;
+    GLuint boundTexture2D[maxUnits] = {};
+    std::map<GLuint, std::vector<UniformValue>> uniformValues;
+    std::vector<UniformValue>* programValues;
+    Counters counters;
+    DrawListener* drawListener = NULL;
+
+    RenderState()
+    {
+        programValues = &uniformValues[0];
+    }
+    RenderState(const RenderState&) = delete;
+    RenderState& operator=(const RenderState&) = delete;
+};
+
+inline void useProgram(GLuint program)
+{
+    RenderState::current().useProgram(program);
+}
+
+inline void bindVertexArray(GLuint vertexArray)
+{
+    RenderState::current().bindVertexArray(vertexArray);
+}
+
+inline void activeTexture(GLenum unit)
+{
+    RenderState::current().activeTexture(unit);
+}
+
+inline void bindTexture(GLenum target, GLuint texture)
+{
+    RenderState::current().bindTexture(target, texture);
+}
+
+inline void drawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    RenderState::current().countDraw(mode, count, 1);
+    glDrawArrays(mode, first, count);
+}
+
+inline void drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    RenderState::current().countDraw(mode, count, 1);
+    glDrawElements(mode, count, type, indices);
+}
+
+inline void drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint baseVertex)
+{
+    RenderState::current().countDraw(mode, count, 1);
+    glDrawElementsBaseVertex(mode, count, type, indices, baseVertex);
+}
+
+inline void drawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instances)
+{
+    RenderState::current().countDraw(mode, count, instances);
+    glDrawElementsInstanced(mode, count, type, indices, instances);
+}
+
+// one call for the driver, so one draw call however many runs it carries
+inline void multiDrawElements(GLenum mode, const GLsizei* counts, GLenum type, const void* const* indices, GLsizei drawCount)
+{
+    GLsizei count = 0;
+    for (GLsizei i = 0; i < drawCount; i++)
+        count += counts[i];
+    RenderState::current().countDraw(mode, count, 1);
+    glMultiDrawElements(mode, counts, type, indices, drawCount);
+}
+
+inline void deleteVertexArrays(GLsizei n, const GLuint* vertexArrays)
+{
+    for (GLsizei i = 0; i < n; i++)
+        RenderState::current().forgetVertexArray(vertexArrays[i]);
+    glDeleteVertexArrays(n, vertexArrays);
+}
+
+inline void deleteTextures(GLsizei n, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; i++)
+        RenderState::current().forgetTexture(textures[i]);
+    glDeleteTextures(n, textures);
+}
+
+inline void deleteProgram(GLuint program)
+{
+    RenderState::current().forgetProgram(program);
+    glDeleteProgram(program);
+}
+
+#endif /* render_state_h */
@@ -10,8 +10,13 @@
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
+#include "render_state.h"
+#include "transform_system.h"
 
 #include <string>
+#include <map>
+#include <memory>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -44,9 +49,9 @@ public:
             // close file handlers
             vShaderFile.close();
             fShaderFile.close();
-            // convert stream into string
-            vertexCode = vShaderStream.str();
-            fragmentCode = fShaderStream.str();
+            // convert stream into string, pasting in the files they #include
+            vertexCode = expandIncludes(vShaderStream.str());
+            fragmentCode = expandIncludes(fShaderStream.str());
         }
         catch (std::ifstream::failure& e)
         {
@@ -75,74 +80,234 @@ public:
         // delete the shaders as they're linked into our program now and no longer necessary
         glDeleteShader(vertex);
         glDeleteShader(fragment);
-
+        // 3. resolve every active uniform once, so setters never ask the driver again
+        cacheUniformLocations();
     }
     // activate the shader
     // ------------------------------------------------------------------------
     void use() const
     {
-        glUseProgram(ID);
+        useProgram(ID);
+    }
+    // cached location of an active uniform, -1 if the program has no such uniform
+    // (glUniform* silently ignores -1, same as an unknown name used to)
+    // ------------------------------------------------------------------------
+    GLint uniformLocation(const char* name) const
+    {
+        std::map<std::string, GLint, std::less<>>::const_iterator it = uniformLocations->find(name);
+        return it == uniformLocations->end() ? -1 : it->second;
+    }
+    // ------------------------------------------------------------------------
+    void bindUniformBlock(const char* name, GLuint binding) const
+    {
+        GLuint index = glGetUniformBlockIndex(ID, name);
+        if (index != GL_INVALID_INDEX)
+            glUniformBlockBinding(ID, index, binding);
     }
     // utility uniform functions
+    // by name goes through the cache, by location is the hot path; values
+    // equal to what the uniform already holds are not sent again
     // ------------------------------------------------------------------------
-    void setBool(const std::string& name, bool value) const
+    void setBool(const char* name, bool value) const
     {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+        setBool(uniformLocation(name), value);
+    }
+    void setBool(GLint location, bool value) const
+    {
+        setInt(location, (int)value);
     }
     // ------------------------------------------------------------------------
-    void setInt(const std::string& name, int value) const
+    void setInt(const char* name, int value) const
+    {
+        setInt(uniformLocation(name), value);
+    }
+    void setInt(GLint location, int value) const
     {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+        if (changed(location, RenderState::UNIFORM_INT, &value, sizeof(value)))
+            glUniform1i(location, value);
     }
     // ------------------------------------------------------------------------
-    void setFloat(const std::string& name, float value) const
+    void setFloat(const char* name, float value) const
     {
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+        setFloat(uniformLocation(name), value);
+    }
+    void setFloat(GLint location, float value) const
+    {
+        if (changed(location, RenderState::UNIFORM_FLOAT, &value, sizeof(value)))
+            glUniform1f(location, value);
     }
     // ------------------------------------------------------------------------
-    void setVec2(const std::string& name, const glm::vec2& value) const
+    void setVec2(const char* name, const glm::vec2& value) const
+    {
+        setVec2(uniformLocation(name), value);
+    }
+    void setVec2(GLint location, const glm::vec2& value) const
+    {
+        if (changed(location, RenderState::UNIFORM_VEC2, &value[0], sizeof(float) * 2))
+            glUniform2fv(location, 1, &value[0]);
+    }
+    void setVec2(const char* name, float x, float y) const
     {
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        setVec2(uniformLocation(name), x, y);
     }
-    void setVec2(const std::string& name, float x, float y) const
+    void setVec2(GLint location, float x, float y) const
     {
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+        setVec2(location, glm::vec2(x, y));
     }
     // ------------------------------------------------------------------------
-    void setVec3(const std::string& name, const glm::vec3& value) const
+    void setVec3(const char* name, const glm::vec3& value) const
+    {
+        setVec3(uniformLocation(name), value);
+    }
+    void setVec3(GLint location, const glm::vec3& value) const
+    {
+        if (changed(location, RenderState::UNIFORM_VEC3, &value[0], sizeof(float) * 3))
+            glUniform3fv(location, 1, &value[0]);
+    }
+    void setVec3(const char* name, float x, float y, float z) const
     {
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        setVec3(uniformLocation(name), x, y, z);
     }
-    void setVec3(const std::string& name, float x, float y, float z) const
+    void setVec3(GLint location, float x, float y, float z) const
     {
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+        setVec3(location, glm::vec3(x, y, z));
     }
     // ------------------------------------------------------------------------
-    void setVec4(const std::string& name, const glm::vec4& value) const
+    void setVec4(const char* name, const glm::vec4& value) const
     {
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        setVec4(uniformLocation(name), value);
     }
-    void setVec4(const std::string& name, float x, float y, float z, float w) const
+    void setVec4(GLint location, const glm::vec4& value) const
     {
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+        if (changed(location, RenderState::UNIFORM_VEC4, &value[0], sizeof(float) * 4))
+            glUniform4fv(location, 1, &value[0]);
+    }
+    void setVec4(const char* name, float x, float y, float z, float w) const
+    {
+        setVec4(uniformLocation(name), x, y, z, w);
+    }
+    void setVec4(GLint location, float x, float y, float z, float w) const
+    {
+        setVec4(location, glm::vec4(x, y, z, w));
     }
     // ------------------------------------------------------------------------
-    void setMat2(const std::string& name, const glm::mat2& mat) const
+    void setMat2(const char* name, const glm::mat2& mat) const
     {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        setMat2(uniformLocation(name), mat);
+    }
+    void setMat2(GLint location, const glm::mat2& mat) const
+    {
+        if (changed(location, RenderState::UNIFORM_MAT2, &mat[0][0], sizeof(float) * 4))
+            glUniformMatrix2fv(location, 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
-    void setMat3(const std::string& name, const glm::mat3& mat) const
+    void setMat3(const char* name, const glm::mat3& mat) const
     {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        setMat3(uniformLocation(name), mat);
+    }
+    void setMat3(GLint location, const glm::mat3& mat) const
+    {
+        if (changed(location, RenderState::UNIFORM_MAT3, &mat[0][0], sizeof(float) * 9))
+            glUniformMatrix3fv(location, 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
-    void setMat4(const std::string& name, const glm::mat4& mat) const
+    void setMat4(const char* name, const glm::mat4& mat) const
     {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        setMat4(uniformLocation(name), mat);
+    }
+    // a program with a normalMatrix uniform gets it along with every new
+    // model, so its vertex shader never inverts a matrix
+    void setMat4(GLint location, const glm::mat4& mat) const
+    {
+        if (changed(location, RenderState::UNIFORM_MAT4, &mat[0][0], sizeof(float) * 16))
+        {
+            glUniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
+            if (location == modelLocation && normalMatrixLocation >= 0)
+                setMat3(normalMatrixLocation, normalMatrixOf(mat));
+        }
     }
 
 private:
+    // uniforms belong to the program in use, like glUniform* itself assumes
+    bool changed(GLint location, RenderState::UniformKind kind, const void* value, size_t bytes) const
+    {
+        return RenderState::current().uniformChanged(location, kind, value, bytes);
+    }
+
+    // shared so that copies of a Shader do not duplicate the table
+    std::shared_ptr<std::map<std::string, GLint, std::less<>>> uniformLocations;
+    GLint modelLocation = -1;
+    GLint normalMatrixLocation = -1;
+
+    // walk the active uniforms of the linked program; arrays are reported as
+    // "name[0]" so the bare name and every element get an entry as well
+    // ------------------------------------------------------------------------
+    void cacheUniformLocations()
+    {
+        uniformLocations = std::make_shared<std::map<std::string, GLint, std::less<>>>();
+
+        GLint count = 0, maxLength = 0;
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::vector<GLchar> buffer(maxLength > 0 ? maxLength : 1);
+        for (GLint i = 0; i < count; i++)
+        {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(ID, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, buffer.data());
+            std::string name(buffer.data(), length);
+            GLint location = glGetUniformLocation(ID, name.c_str());
+            // members of uniform blocks have no location
+            if (location < 0)
+                continue;
+            (*uniformLocations)[name] = location;
+
+            if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            {
+                std::string base = name.substr(0, name.size() - 3);
+                (*uniformLocations)[base] = location;
+                for (GLint element = 1; element < size; element++)
+                {
+                    std::string elementName = base + "[" + std::to_string(element) + "]";
+                    (*uniformLocations)[elementName] = glGetUniformLocation(ID, elementName.c_str());
+                }
+            }
+        }
+        modelLocation = uniformLocation("model");
+        normalMatrixLocation = uniformLocation("normalMatrix");
+    }
+
+    // replaces every #include "file" line with that file, so shaders can share
+    // declarations and functions (lighting.glsl). A #line after it keeps the
+    // line numbers of compile errors pointing into the including file.
+    // ------------------------------------------------------------------------
+    static std::string expandIncludes(const std::string& code)
+    {
+        std::istringstream lines(code);
+        std::string expanded, line;
+        int number = 0;
+        while (std::getline(lines, line))
+        {
+            number++;
+            size_t open = line.find('"');
+            size_t close = line.rfind('"');
+            if (line.compare(0, 8, "#include") != 0 || open == std::string::npos || close == open)
+            {
+                expanded += line + '\n';
+                continue;
+            }
+            std::ifstream file;
+            file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+            file.open(line.substr(open + 1, close - open - 1).c_str());
+            std::stringstream stream;
+            stream << file.rdbuf();
+            expanded += expandIncludes(stream.str());
+            expanded += "#line " + std::to_string(number + 1) + '\n';
+        }
+        return expanded;
+    }
+
     // utility function for checking shader compilation/linking errors.
     // ------------------------------------------------------------------------
     void checkCompileErrors(GLuint shader, std::string type)
@@ -0,0 +1,498 @@
+#ifndef shadow_atlas_h
+#define shadow_atlas_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include "shader.h"
+#include "frustum.h"
+#include "portal.h"
+#include "gl_handle.h"
+#include "render_state.h"
+#include "pointLight.h"
+#include "spotLight.h"
+#include "light_clusters.h"
+
+// Shadows of the point and spot lights, all in one depth texture cut into
+// square tiles. A point light takes six tiles, the faces of a cube around it
+// each seen with a 90 degree perspective; a spot light takes one, seen along
+// its direction as wide as its outer cone. GL 3.3 cannot index an array of
+// cube maps from a loop over lights, a single 2D atlas it can, so
+// fragmentShader.fs picks the cube face of a fragment by the largest axis of
+// the way from the light to it and works out where it falls in that face's
+// tile itself.
+//
+// Tiles go to the lights that are on and reach a visible room, nearest first;
+// a light that needs tiles when none are free takes them from the light seen
+// longest ago. A light is shadowed once all its faces are drawn.
+//
+// Faces are only drawn again when they have to be: when the light moves or
+// changes, or when a part that moved this frame (place()) is inside the
+// face's frustum. Even then update() schedules at most facesPerFrame faces a
+// frame, nearest lights first, the longer a face waits the sooner it goes, so
+// a face out of date is drawn a few frames late rather than the frame taking
+// longer. Until then the tile keeps what it had.
+//
+// What the shaders need of a light's shadow is one texel, put after its six
+// in the light buffer (light_clusters.h): for a point light the tiles of its
+// faces two to a float, for a spot light its tile and the tangent of its half
+// angle, and the far plane in w. x is -1 for a light without shadows.
+class ShadowAtlas {
+public:
+    static const int size = 4096;
+    static const int tileSize = 256;
+    static const int tilesPerRow = size / tileSize;
+    static const int tileCount = tilesPerRow * tilesPerRow;
+    static const int maxFacesPerFrame = 96;
+    // the atlas goes after the directional light's cascades (cascaded_shadow_map.h)
+    static const int unit = 12;
+    // both planes of every face; lights reaching further cast no shadow past maxRange
+    static constexpr float nearPlane = 0.05f;
+    static constexpr float maxRange = 40.0f;
+
+    ShadowAtlas()
+    {
+        glGenTextures(1, &depth);
+        glGenFramebuffers(1, &buffer);
+        GLint previous = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+        activeTexture(GL_TEXTURE0 + unit);
+        bindTexture(GL_TEXTURE_2D, depth);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, size, size, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        activeTexture(GL_TEXTURE0);
+        glBindFramebuffer(GL_FRAMEBUFFER, buffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depth, 0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cout << "Shadow atlas is incomplete" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, previous);
+
+        // handed out from the back, so the first lights get the first tiles
+        for (int tile = tileCount - 1; tile >= 0; tile--)
+            freeTiles.push_back(tile);
+    }
+
+    ~ShadowAtlas()
+    {
+        deleteTextures(1, &depth);
+        glDeleteFramebuffers(1, &buffer);
+    }
+
+    ShadowAtlas(const ShadowAtlas&) = delete;
+    ShadowAtlas& operator=(const ShadowAtlas&) = delete;
+
+    // the lights are read every update(), they have to outlive the atlas; the
+    // number is the light's texel in texels()
+    int add(const PointLight* light)
+    {
+        Light entry;
+        entry.point = light;
+        entry.faces = 6;
+        return addLight(entry);
+    }
+
+    int add(const SpotLight* light)
+    {
+        Light entry;
+        entry.spot = light;
+        entry.faces = 1;
+        return addLight(entry);
+    }
+
+    // something that moves and casts; place() it every frame
+    int addMover()
+    {
+        movers.push_back(BoundingBox());
+        moved.reserve(movers.size());
+        return (int)movers.size() - 1;
+    }
+
+    // where a mover is this frame; the faces that saw it where it was or see
+    // it now are drawn again when it moved, or its box did
+    void place(int mover, const BoundingBox& box, bool moving)
+    {
+        BoundingBox& last = movers[mover];
+        if (moving || box.min != last.min || box.max != last.max)
+        {
+            BoundingBox swept = last;
+            swept.expand(box);
+            moved.push_back(swept);
+        }
+        last = box;
+    }
+
+    // faces drawn per frame at most
+    void setBudget(int faces)
+    {
+        budget = faces < 1 ? 1 : (faces > maxFacesPerFrame ? maxFacesPerFrame : faces);
+    }
+
+    int facesPerFrame() const
+    {
+        return budget;
+    }
+
+    // points a lit shader's sampler at the atlas; shader must be in use
+    void attach(const Shader& shader) const
+    {
+        shader.setInt("shadowAtlas", unit);
+    }
+
+    // hands out tiles and picks the faces to draw this frame for a camera that
+    // sees view and the visible cells of cells from eye. Every scheduled face
+    // counts as drawn from here on, so they have to be before anything is lit;
+    // the count is how many there are
+    int update(const Frustum& view, const CellGraph& cells, const glm::vec3& eye)
+    {
+        frame++;
+        scheduled = 0;
+        order.clear();
+        for (int i = 0; i < (int)lights.size(); i++)
+        {
+            Light& light = lights[i];
+            if (!read(light))
+            {
+                release(light);
+                continue;
+            }
+            BoundingBox reach;
+            reach.expand(light.position - glm::vec3(light.far));
+            reach.expand(light.position + glm::vec3(light.far));
+            light.distance = glm::length(light.position - eye);
+            if (view.intersects(light.position, light.far) && cells.intersects(reach))
+            {
+                light.lastSeen = frame;
+                order.push_back(i);
+            }
+        }
+
+        // what moved dirties the faces that see it
+        for (const BoundingBox& box : moved)
+            for (Light& light : lights)
+            {
+                if (light.tiles[0] < 0 || box.distanceTo(light.position) > light.far)
+                    continue;
+                for (int face = 0; face < light.faces; face++)
+                    if (light.frusta[face].intersects(box))
+                        markDirty(light, 1u << face);
+            }
+        moved.clear();
+
+        // tiles for the visible lights still without them, nearest first
+        std::sort(order.begin(), order.end(), [this](int a, int b) { return lights[a].distance < lights[b].distance; });
+        for (int i : order)
+        {
+            Light& light = lights[i];
+            if (light.tiles[0] >= 0)
+                continue;
+            while ((int)freeTiles.size() < light.faces && evict())
+                ;
+            if ((int)freeTiles.size() < light.faces)
+                continue;
+            for (int face = 0; face < light.faces; face++)
+            {
+                light.tiles[face] = freeTiles.back();
+                freeTiles.pop_back();
+            }
+            light.drawn = 0;
+            markDirty(light, allFaces(light));
+        }
+
+        // the faces to draw, nearest first but sooner the longer they waited
+        std::sort(order.begin(), order.end(), [this](int a, int b) { return priority(lights[a]) < priority(lights[b]); });
+        for (int i : order)
+        {
+            Light& light = lights[i];
+            if (light.tiles[0] < 0)
+                continue;
+            for (int face = 0; face < light.faces && scheduled < budget; face++)
+                if (light.dirty & (1u << face))
+                {
+                    queue[scheduled].light = i;
+                    queue[scheduled].face = face;
+                    scheduled++;
+                    light.dirty &= ~(1u << face);
+                    light.drawn |= 1u << face;
+                }
+            if (scheduled == budget)
+                break;
+        }
+
+        waiting = 0;
+        shadowed = 0;
+        for (int i = 0; i < (int)lights.size(); i++)
+        {
+            const Light& light = lights[i];
+            for (int face = 0; face < light.faces; face++)
+                if (light.tiles[0] >= 0 && (light.dirty & (1u << face)))
+                    waiting++;
+            texelData[i] = texelOf(light);
+            if (texelData[i].x >= 0.0f)
+                shadowed++;
+        }
+        return scheduled;
+    }
+
+    // no light is shadowed until the next update(), which draws every face again
+    void clear()
+    {
+        scheduled = 0;
+        waiting = 0;
+        shadowed = 0;
+        moved.clear();
+        for (int i = 0; i < (int)lights.size(); i++)
+        {
+            lights[i].drawn = 0;
+            markDirty(lights[i], allFaces(lights[i]));
+            texelData[i] = glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f);
+        }
+    }
+
+    // a scheduled face's view and projection, for drawing into it
+    const glm::mat4& view(int face) const
+    {
+        return lights[queue[face].light].views[queue[face].face];
+    }
+
+    const glm::mat4& projection(int face) const
+    {
+        return lights[queue[face].light].projection;
+    }
+
+    // what may cast into a scheduled face, for culling
+    const Frustum& frustum(int face) const
+    {
+        return lights[queue[face].light].frusta[queue[face].face];
+    }
+
+    // draws that follow go into a scheduled face's tile, cleared first
+    void begin(int face)
+    {
+        int tile = lights[queue[face].light].tiles[queue[face].face];
+        int x = (tile % tilesPerRow) * tileSize, y = (tile / tilesPerRow) * tileSize;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glBindFramebuffer(GL_FRAMEBUFFER, buffer);
+        glViewport(x, y, tileSize, tileSize);
+        glScissor(x, y, tileSize, tileSize);
+        glEnable(GL_SCISSOR_TEST);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glDisable(GL_SCISSOR_TEST);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(2.0f, 4.0f);
+    }
+
+    // back to the framebuffer and viewport of before begin()
+    void end()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    }
+
+    // binds the atlas for the lit shaders
+    void bind() const
+    {
+        activeTexture(GL_TEXTURE0 + unit);
+        bindTexture(GL_TEXTURE_2D, depth);
+        activeTexture(GL_TEXTURE0);
+    }
+
+    // the shadow texel of every light, by the number add() gave it
+    const std::vector<glm::vec4>& texels() const
+    {
+        return texelData;
+    }
+
+    // faces the last update() scheduled, and those it left out of date
+    int scheduledFaces() const
+    {
+        return scheduled;
+    }
+
+    int waitingFaces() const
+    {
+        return waiting;
+    }
+
+    int shadowedLights() const
+    {
+        return shadowed;
+    }
+
+    int lightCount() const
+    {
+        return (int)lights.size();
+    }
+
+    size_t bytes() const
+    {
+        return (size_t)size * size * 4;
+    }
+
+private:
+    struct Light {
+        const PointLight* point = nullptr;
+        const SpotLight* spot = nullptr;
+        int faces = 0;
+        int tiles[6] = { -1, -1, -1, -1, -1, -1 };
+        glm::vec3 position = glm::vec3(0.0f);
+        glm::vec3 direction = glm::vec3(0.0f);
+        float far = 0.0f;
+        float tanHalf = 1.0f;
+        glm::mat4 projection;
+        glm::mat4 views[6];
+        Frustum frusta[6];
+        unsigned int dirty = 0;     // faces to draw again
+        unsigned int drawn = 0;     // faces whose tile holds their depth
+        int dirtySince = 0;
+        int lastSeen = 0;
+        float distance = 0.0f;
+    };
+
+    struct Face {
+        int light;
+        int face;
+    };
+
+    GLuint depth = 0;
+    GLuint buffer = 0;
+    std::vector<Light> lights;
+    std::vector<glm::vec4> texelData;
+    std::vector<int> freeTiles;
+    std::vector<int> order;
+    std::vector<BoundingBox> movers;
+    std::vector<BoundingBox> moved;
+    Face queue[maxFacesPerFrame];
+    int scheduled = 0;
+    int waiting = 0;
+    int shadowed = 0;
+    int budget = 12;
+    int frame = 0;
+    GLint target = 0;
+    GLint viewport[4] = {};
+
+    int addLight(const Light& light)
+    {
+        lights.push_back(light);
+        texelData.push_back(glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f));
+        order.reserve(lights.size());
+        return (int)lights.size() - 1;
+    }
+
+    static unsigned int allFaces(const Light& light)
+    {
+        return (1u << light.faces) - 1u;
+    }
+
+    void markDirty(Light& light, unsigned int faces)
+    {
+        if (light.dirty == 0)
+            light.dirtySince = frame;
+        light.dirty |= faces;
+    }
+
+    float priority(const Light& light) const
+    {
+        return light.distance / (1.0f + (float)(frame - light.dirtySince));
+    }
+
+    // the light as it is this frame, its faces placed again and dirtied if
+    // it moved or changed; false for a light that is off
+    bool read(Light& light)
+    {
+        glm::vec3 position, direction(0.0f);
+        float range, tanHalf = 1.0f;
+        if (light.point != nullptr)
+        {
+            PointLightBlock block;
+            light.point->setUpLight(block);
+            position = glm::vec3(block.position);
+            range = LightClusters::reach(block.ambient, block.diffuse, block.specular, block.Kc, block.Kl, block.Kq);
+        }
+        else
+        {
+            SpotLightBlock block;
+            light.spot->setUpLight(block);
+            position = glm::vec3(block.position);
+            direction = glm::normalize(block.direction);
+            range = LightClusters::reach(block.ambient, block.diffuse, block.specular, block.Kc, block.Kl, block.Kq);
+            // a little wider than the cone, so its filtered edge stays in the tile
+            tanHalf = std::tan(std::min(std::acos(block.outerCutOff) * 1.1f, glm::radians(80.0f)));
+        }
+        if (range <= 0.0f)
+            return false;
+        float far = std::min(range, maxRange);
+        if (position == light.position && direction == light.direction && far == light.far && tanHalf == light.tanHalf)
+            return true;
+
+        light.position = position;
+        light.direction = direction;
+        light.far = far;
+        light.tanHalf = tanHalf;
+        light.projection = glm::perspective(2.0f * std::atan(tanHalf), 1.0f, nearPlane, far);
+        // +x, -x, +y, -y, +z, -z; the shaders pick the same faces the same way
+        static const glm::vec3 axes[6] = { glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f),
+            glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f) };
+        for (int face = 0; face < light.faces; face++)
+        {
+            glm::vec3 forward = light.point != nullptr ? axes[face] : direction;
+            glm::vec3 up = std::fabs(forward.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            light.views[face] = glm::lookAt(position, position + forward, up);
+            light.frusta[face] = Frustum(light.projection * light.views[face]);
+        }
+        markDirty(light, allFaces(light));
+        return true;
+    }
+
+    void release(Light& light)
+    {
+        if (light.tiles[0] < 0)
+            return;
+        for (int face = 0; face < light.faces; face++)
+        {
+            freeTiles.push_back(light.tiles[face]);
+            light.tiles[face] = -1;
+        }
+        light.drawn = 0;
+    }
+
+    // frees the tiles of the light with tiles seen longest ago, if it is not
+    // seen this frame
+    bool evict()
+    {
+        Light* oldest = nullptr;
+        for (Light& light : lights)
+            if (light.tiles[0] >= 0 && light.lastSeen != frame && (oldest == nullptr || light.lastSeen < oldest->lastSeen))
+                oldest = &light;
+        if (oldest == nullptr)
+            return false;
+        release(*oldest);
+        return true;
+    }
+
+    glm::vec4 texelOf(const Light& light) const
+    {
+        if (light.tiles[0] < 0 || light.drawn != allFaces(light))
+            return glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f);
+        if (light.spot != nullptr)
+            return glm::vec4((float)light.tiles[0], light.tanHalf, 0.0f, light.far);
+        return glm::vec4((float)(light.tiles[0] + light.tiles[1] * tileCount), (float)(light.tiles[2] + light.tiles[3] * tileCount),
+            (float)(light.tiles[4] + light.tiles[5] * tileCount), light.far);
+    }
+};
+
+#endif /* shadow_atlas_h */
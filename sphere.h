@@ -138,16 +138,16 @@ public:
         lightingShaderWithTexture.setVec3("material.specular", this->specular);
         lightingShaderWithTexture.setFloat("material.shininess", this->shininess);
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, this->diffuseMap);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, this->diffuseMap);
 
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, this->specularMap);
+        activeTexture(GL_TEXTURE1);
+        bindTexture(GL_TEXTURE_2D, this->specularMap);
 
         lightingShaderWithTexture.setMat4("model", model);
 
-        glBindVertexArray(sphereTexVAO);
-        glDrawElements(GL_TRIANGLES, getIndexCount(), GL_UNSIGNED_INT, 0);
+        bindVertexArray(sphereTexVAO);
+        drawElements(GL_TRIANGLES, getIndexCount(), GL_UNSIGNED_INT, 0);
     }
     // draw in VertexArray mode
     void drawSphere(Shader& lightingShader, glm::mat4 model) const      // draw surface
@@ -163,14 +163,14 @@ public:
         lightingShader.setMat4("model", model);
 
         // draw a sphere with VAO
-        glBindVertexArray(sphereVAO);
-        glDrawElements(GL_TRIANGLES,                    // primitive type
+        bindVertexArray(sphereVAO);
+        drawElements(GL_TRIANGLES,                    // primitive type
             this->getIndexCount(),          // # of indices
             GL_UNSIGNED_INT,                 // data type
             (void*)0);                       // offset to indices
 
         // unbind VAO
-        glBindVertexArray(0);
+        bindVertexArray(0);
     }
 
 private:
@@ -295,7 +295,7 @@ private:
         glGenBuffers(1, &sphereVBO);
         glGenBuffers(1, &sphereEBO);
 
-        glBindVertexArray(sphereTexVAO);
+        bindVertexArray(sphereTexVAO);
 
         glBindBuffer(GL_ARRAY_BUFFER, sphereVBO);
         int stride = this->getVerticesStride();
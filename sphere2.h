@@ -31,7 +31,7 @@ public:
         buildVertices();
 
         glGenVertexArrays(1, &sphereVAO);
-        glBindVertexArray(sphereVAO);
+        bindVertexArray(sphereVAO);
 
         // create VBO to copy vertex data to VBO
         unsigned int sphereVBO;
@@ -61,7 +61,7 @@ public:
         glVertexAttribPointer(1, 3, GL_FLOAT, false, stride, (void*)(sizeof(float) * 3));
 
         // unbind VAO and VBOs
-        glBindVertexArray(0);
+        bindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
@@ -151,14 +151,14 @@ public:
         //lightingShader.setMat4("model", model);
 
         // draw a sphere with VAO
-        glBindVertexArray(sphereVAO);
-        glDrawElements(GL_TRIANGLES,                    // primitive type
+        bindVertexArray(sphereVAO);
+        drawElements(GL_TRIANGLES,                    // primitive type
             this->getIndexCount(),          // # of indices
             GL_UNSIGNED_INT,                 // data type
             (void*)0);                       // offset to indices
 
         // unbind VAO
-        glBindVertexArray(0);
+        bindVertexArray(0);
     }
 
 private:
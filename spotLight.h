@@ -5,6 +5,23 @@
 #include <glm/glm.hpp>
 #include "shader.h"
 
+// what fragmentShader.fs gets of a SpotLight, LightClusters packs it into the
+// light buffer; cutOff/outerCutOff are cosines
+struct SpotLightBlock {
+    glm::vec4 position;
+    glm::vec3 direction;
+    float cutOff;
+    float outerCutOff;
+    float padding0[3];
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+    float Kc;
+    float Kl;
+    float Kq;
+    float padding1;
+};
+
 class SpotLight {
 public:
     glm::vec3 position;
@@ -36,19 +53,18 @@ public:
         lightNumber = num;
     }
 
-    void setUpLight(Shader& lightingShader)
+    void setUpLight(SpotLightBlock& block) const
     {
-        lightingShader.use();
-        lightingShader.setVec4("spotLight.ambient", ambient * ambientOn * isOn);
-        lightingShader.setVec4("spotLight.diffuse", diffuse * diffuseOn * isOn);
-        lightingShader.setVec4("spotLight.specular", specular * specularOn * isOn);
-        lightingShader.setVec3("spotLight.position", position);
-        lightingShader.setVec3("spotLight.direction", direction);
-        lightingShader.setFloat("spotLight.cutOff", glm::cos(glm::radians(cutOff)));
-        lightingShader.setFloat("spotLight.outerCutOff", glm::cos(glm::radians(outerCutOff)));
-        lightingShader.setFloat("spotLight.Kc", Kc);
-        lightingShader.setFloat("spotLight.Kl", Kl);
-        lightingShader.setFloat("spotLight.Kq", Kq);
+        block.ambient = ambient * ambientOn * isOn;
+        block.diffuse = diffuse * diffuseOn * isOn;
+        block.specular = specular * specularOn * isOn;
+        block.position = glm::vec4(position, 1.0f);
+        block.direction = direction;
+        block.cutOff = glm::cos(glm::radians(cutOff));
+        block.outerCutOff = glm::cos(glm::radians(outerCutOff));
+        block.Kc = Kc;
+        block.Kl = Kl;
+        block.Kq = Kq;
     }
 
     void turnOff()
@@ -0,0 +1,468 @@
+#ifndef static_batch_h
+#define static_batch_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include "shader.h"
+#include "gl_handle.h"
+#include "frustum.h"
+#include "portal.h"
+#include "texture_array.h"
+#include "transform_system.h"
+
+// one placement of an instanced batch, see StaticBatch::setInstances()
+struct BatchInstance {
+    glm::mat4 model;
+    glm::vec4 tint;     // multiplies the recorded material's ambient and diffuse
+    NormalMatrix normal = {};   // of model, filled in by setInstances()
+};
+
+// Retained copy of every cube that never moves. The scene is "drawn" once
+// between begin() and end(); each cube is captured with the model matrix, material and
+// texture it would have been rendered with, pre-transformed into world space
+// and packed into a single VBO/EBO sorted by texture. Per frame the whole
+// static hospital then costs one glDrawElements per distinct texture.
+//
+// The same recording of a single composite object drawn at the origin makes
+// a prototype: after setInstances() every texture group is drawn with one
+// glDrawElementsInstanced for all placements.
+//
+// draw() skips what the camera cannot see: every baked cube keeps its world
+// box, which has to be inside the frustum and touch a visible cell, and the
+// visible runs of a texture group go out in one glMultiDrawElements. Instances are tested with the prototype's box moved to
+// their placement and only the visible ones are kept in the instance buffer.
+//
+// With sortFrontToBack() every group goes out nearest first: each visible
+// cube becomes a run of its own, ordered by how far its box is from the
+// viewer, and visible instances are ordered the same way. Near walls then fill
+// the depth buffer before what they hide is drawn, so the hidden fragments
+// fail the depth test instead of being shaded.
+//
+// Once useTextureArray() has been given an array holding all of the batch's
+// textures, each vertex carries its layer and the texture groups collapse
+// into one, so the whole batch is a single draw.
+class StaticBatch {
+public:
+    StaticBatch(const float* cubeVertices, const unsigned int* cubeIndices)
+    {
+        this->cubeVertices.assign(cubeVertices, cubeVertices + 24 * 8);
+        this->cubeIndices.assign(cubeIndices, cubeIndices + 36);
+    }
+
+    ~StaticBatch()
+    {
+        deleteVertexArrays(1, &batchVAO);
+        glDeleteBuffers(1, &batchVBO);
+        glDeleteBuffers(1, &batchEBO);
+        glDeleteBuffers(1, &instanceVBO);
+    }
+
+    StaticBatch(const StaticBatch&) = delete;
+    StaticBatch& operator=(const StaticBatch&) = delete;
+
+    void begin()
+    {
+        records.clear();
+    }
+
+    // called instead of glDrawElements between begin() and end()
+    void capture(const Shader& shader)
+    {
+        // what the cube was drawn with comes from RenderState's shadow copy,
+        // asking the driver would stall on every captured cube
+        RenderState& state = RenderState::current();
+        CubeRecord record;
+        record.model = glm::mat4(1.0f);
+        record.material = 0;
+        const float* model = state.cachedUniform(shader.uniformLocation("model"));
+        if (model != NULL)
+            std::memcpy(&record.model[0][0], model, sizeof(record.model));
+        const float* material = state.cachedUniform(shader.uniformLocation("materialIndex"));
+        if (material != NULL)
+            std::memcpy(&record.material, material, sizeof(record.material));
+        record.texture = state.boundTexture(0);
+
+        // zero scaled cubes never produce a fragment
+        if (glm::determinant(glm::mat3(record.model)) != 0.0f)
+            records.push_back(record);
+    }
+
+    void end()
+    {
+        build();
+    }
+
+    // per-instance model matrix at attributes 7-10, tint at 11 and normal
+    // matrix at 13-15
+    void setInstances(const std::vector<BatchInstance>& instances)
+    {
+        if (instanceVBO == 0)
+        {
+            glGenBuffers(1, &instanceVBO);
+            bindVertexArray(batchVAO);
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+            GLsizei bytes = sizeof(BatchInstance);
+            for (int column = 0; column < 4; column++)
+            {
+                glVertexAttribPointer(7 + column, 4, GL_FLOAT, GL_FALSE, bytes, (void*)(column * sizeof(glm::vec4)));
+                glEnableVertexAttribArray(7 + column);
+                glVertexAttribDivisor(7 + column, 1);
+            }
+            glVertexAttribPointer(11, 4, GL_FLOAT, GL_FALSE, bytes, (void*)(4 * sizeof(glm::vec4)));
+            glEnableVertexAttribArray(11);
+            glVertexAttribDivisor(11, 1);
+            for (int column = 0; column < 3; column++)
+            {
+                glVertexAttribPointer(13 + column, 3, GL_FLOAT, GL_FALSE, bytes, (void*)((5 + column) * sizeof(glm::vec4)));
+                glEnableVertexAttribArray(13 + column);
+                glVertexAttribDivisor(13 + column, 1);
+            }
+            bindVertexArray(0);
+        }
+        allInstances = instances;
+        std::vector<glm::mat4> models(instances.size());
+        std::vector<NormalMatrix> normals(instances.size());
+        for (size_t i = 0; i < instances.size(); i++)
+            models[i] = instances[i].model;
+        computeNormalMatrices(models.data(), normals.data(), models.size());
+        for (size_t i = 0; i < instances.size(); i++)
+            allInstances[i].normal = normals[i];
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, allInstances.size() * sizeof(BatchInstance), allInstances.data(), GL_DYNAMIC_DRAW);
+        instanceCount = (GLsizei)instances.size();
+        visibleInstances.clear();
+        visibleInstances.reserve(instances.size());
+        drawOrder.reserve(instances.size());
+        uploadedInstances = allInstances.size();
+    }
+
+    // draws nearest to eye first from now on, or in recorded order with NULL;
+    // eye is read at every draw()
+    void sortFrontToBack(const glm::vec3* eye)
+    {
+        viewer = eye;
+    }
+
+    // every 2D texture the batch binds, for packing into a TextureArray
+    void collectTextures(std::vector<GLuint>& textures) const
+    {
+        for (const CubeRecord& record : records)
+            textures.push_back(record.texture);
+    }
+
+    // rebuilds the batch around textureArray, or back around the individual
+    // textures with NULL; false if the array is missing one of them
+    bool useTextureArray(const TextureArray* textureArray)
+    {
+        if (textureArray != NULL)
+            for (const CubeRecord& record : records)
+                if (textureArray->layerOf(record.texture) < 0)
+                    return false;
+        this->textureArray = textureArray;
+        build();
+        return true;
+    }
+
+    void draw(Shader& shader, const Frustum& frustum, const CellGraph& cells, CullCounters& counters)
+    {
+        if (groups.empty())
+            return;
+
+        bool instanced = instanceVBO != 0;
+        if (instanced && cullInstances(frustum, cells, counters) == 0)
+            return;
+        if (!instanced && cullCubes(frustum, cells, counters) == 0)
+            return;
+
+        shader.setBool("useVertexMaterial", true);
+        shader.setBool("useInstancing", instanced);
+        shader.setMat4("model", glm::mat4(1.0f));
+        if (textureArray != NULL)
+        {
+            shader.setBool("useTextureArray", true);
+            activeTexture(GL_TEXTURE1);
+            bindTexture(GL_TEXTURE_2D_ARRAY, textureArray->texture());
+            activeTexture(GL_TEXTURE0);
+            // nothing is sampled from unit 0, the draw should not count as a use of what it holds
+            bindTexture(GL_TEXTURE_2D, 0);
+        }
+        bindVertexArray(batchVAO);
+        for (const TextureGroup& group : groups)
+        {
+            if (!instanced && group.firstRun == group.endRun)
+                continue;
+            if (textureArray == NULL)
+                bindTexture(GL_TEXTURE_2D, group.texture);
+            if (instanced)
+            {
+                void* offset = (void*)(group.firstIndex * sizeof(unsigned int));
+                drawElementsInstanced(GL_TRIANGLES, group.indexCount, GL_UNSIGNED_INT, offset, instanceCount);
+            }
+            else
+                multiDrawElements(GL_TRIANGLES, &runCounts[group.firstRun], GL_UNSIGNED_INT, &runOffsets[group.firstRun], group.endRun - group.firstRun);
+        }
+        shader.setBool("useVertexMaterial", false);
+        shader.setBool("useInstancing", false);
+        shader.setBool("useTextureArray", false);
+    }
+
+    int cubeCount() const
+    {
+        return (int)records.size();
+    }
+
+    int drawCount() const
+    {
+        return (int)groups.size();
+    }
+
+    int instances() const
+    {
+        return (int)allInstances.size();
+    }
+
+    // world box of everything recorded, before any instancing
+    const BoundingBox& bounds() const
+    {
+        return recordedBounds;
+    }
+
+private:
+    struct CubeRecord {
+        glm::mat4 model;
+        GLint material;     // index into the MaterialTable
+        unsigned int texture;
+    };
+
+    // a visible cube or instance and its distance from the viewer
+    struct DrawOrder {
+        float distance;
+        unsigned int item;
+
+        bool operator<(const DrawOrder& other) const
+        {
+            return distance != other.distance ? distance < other.distance : item < other.item;
+        }
+    };
+
+    struct TextureGroup {
+        unsigned int texture;
+        unsigned int firstIndex;
+        int indexCount;
+        // this frame's visible runs in runCounts/runOffsets
+        int firstRun;
+        int endRun;
+    };
+
+    // position, normal, uv, material, layer
+    static const int stride = 10;
+
+    std::vector<float> cubeVertices;
+    std::vector<unsigned int> cubeIndices;
+    std::vector<CubeRecord> records;
+    std::vector<TextureGroup> groups;
+    // world box of each packed cube, in index buffer order
+    std::vector<BoundingBox> cubeBounds;
+    BoundingBox recordedBounds;
+    // reused every frame so culling does not allocate
+    std::vector<GLsizei> runCounts;
+    std::vector<const void*> runOffsets;
+    std::vector<BatchInstance> allInstances;
+    std::vector<BatchInstance> visibleInstances;
+    std::vector<DrawOrder> drawOrder;
+    size_t uploadedInstances = 0;
+    // kept between builds so re-recording a prototype reuses their storage
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    GLHandle batchVAO;
+    GLHandle batchVBO;
+    GLHandle batchEBO;
+    GLHandle instanceVBO;
+    GLsizei instanceCount = 0;
+    const TextureArray* textureArray = NULL;
+    const glm::vec3* viewer = NULL;
+
+    void build()
+    {
+        // keep the original submission order inside a texture so coplanar
+        // faces still resolve the same way under GL_LESS
+        std::stable_sort(records.begin(), records.end(), [](const CubeRecord& a, const CubeRecord& b) {
+            return a.texture < b.texture;
+        });
+
+        vertices.clear();
+        indices.clear();
+        vertices.reserve(records.size() * 24 * stride);
+        indices.reserve(records.size() * 36);
+        groups.clear();
+        cubeBounds.clear();
+        cubeBounds.reserve(records.size());
+        recordedBounds = BoundingBox();
+
+        for (const CubeRecord& record : records)
+        {
+            // all layers of an array are one group
+            unsigned int groupTexture = textureArray != NULL ? textureArray->texture() : record.texture;
+            if (groups.empty() || groups.back().texture != groupTexture)
+                groups.push_back({ groupTexture, (unsigned int)indices.size(), 0, 0, 0 });
+            float layer = textureArray != NULL ? (float)textureArray->layerOf(record.texture) : 0.0f;
+
+            glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(record.model)));
+            unsigned int base = (unsigned int)(vertices.size() / stride);
+            BoundingBox box;
+            for (int v = 0; v < 24; v++)
+            {
+                const float* src = &cubeVertices[v * 8];
+                glm::vec3 position = glm::vec3(record.model * glm::vec4(src[0], src[1], src[2], 1.0f));
+                glm::vec3 normal = normalMatrix * glm::vec3(src[3], src[4], src[5]);
+                box.expand(position);
+
+                vertices.insert(vertices.end(), { position.x, position.y, position.z, normal.x, normal.y, normal.z, src[6], src[7] });
+                vertices.push_back((float)record.material);
+                vertices.push_back(layer);
+            }
+            for (unsigned int index : cubeIndices)
+                indices.push_back(base + index);
+            groups.back().indexCount += 36;
+            cubeBounds.push_back(box);
+            recordedBounds.expand(box);
+        }
+        runCounts.reserve(records.size());
+        runOffsets.reserve(records.size());
+        drawOrder.reserve(std::max(records.size(), allInstances.size()));
+
+        if (batchVAO == 0)
+        {
+            glGenVertexArrays(1, &batchVAO);
+            glGenBuffers(1, &batchVBO);
+            glGenBuffers(1, &batchEBO);
+        }
+        bindVertexArray(batchVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, batchVBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batchEBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+        GLsizei bytes = stride * sizeof(float);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, bytes, (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, bytes, (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, bytes, (void*)(6 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, bytes, (void*)(8 * sizeof(float)));
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(12, 1, GL_FLOAT, GL_FALSE, bytes, (void*)(9 * sizeof(float)));
+        glEnableVertexAttribArray(12);
+        bindVertexArray(0);
+    }
+
+    // fills runCounts/runOffsets with the visible stretches of every group,
+    // neighbouring visible cubes are merged into one run unless the runs are
+    // sorted
+    int cullCubes(const Frustum& frustum, const CellGraph& cells, CullCounters& counters)
+    {
+        runCounts.clear();
+        runOffsets.clear();
+        int visible = 0;
+        for (TextureGroup& group : groups)
+        {
+            group.firstRun = (int)runCounts.size();
+            unsigned int firstCube = group.firstIndex / 36;
+            unsigned int endCube = firstCube + group.indexCount / 36;
+            bool extending = false;
+            for (unsigned int cube = firstCube; cube < endCube; cube++)
+            {
+                if (!frustum.intersects(cubeBounds[cube]) || !cells.intersects(cubeBounds[cube]))
+                {
+                    extending = false;
+                    continue;
+                }
+                if (extending && viewer == NULL)
+                    runCounts.back() += 36;
+                else
+                {
+                    runCounts.push_back(36);
+                    runOffsets.push_back((const void*)(cube * 36 * sizeof(unsigned int)));
+                }
+                extending = true;
+                visible++;
+            }
+            group.endRun = (int)runCounts.size();
+            if (viewer != NULL)
+                sortRuns(group);
+        }
+        counters.tested += (int)cubeBounds.size();
+        counters.culled += (int)cubeBounds.size() - visible;
+        return visible;
+    }
+
+    // a sorted group's runs are single cubes, they are put in order of their
+    // boxes' distance from the viewer
+    void sortRuns(const TextureGroup& group)
+    {
+        drawOrder.clear();
+        for (int run = group.firstRun; run < group.endRun; run++)
+        {
+            unsigned int cube = (unsigned int)((size_t)runOffsets[run] / (36 * sizeof(unsigned int)));
+            drawOrder.push_back({ cubeBounds[cube].distanceTo(*viewer), cube });
+        }
+        std::sort(drawOrder.begin(), drawOrder.end());
+        for (size_t i = 0; i < drawOrder.size(); i++)
+            runOffsets[group.firstRun + i] = (const void*)(drawOrder[i].item * 36 * sizeof(unsigned int));
+    }
+
+    // moves the visible placements to the front of the instance buffer,
+    // nearest first when sorted, re-uploading only when the visible set or its
+    // order differs from last frame
+    int cullInstances(const Frustum& frustum, const CellGraph& cells, CullCounters& counters)
+    {
+        drawOrder.clear();
+        for (size_t i = 0; i < allInstances.size(); i++)
+        {
+            BoundingBox box = recordedBounds.transformed(allInstances[i].model);
+            if (!frustum.intersects(box) || !cells.intersects(box))
+                continue;
+            drawOrder.push_back({ viewer != NULL ? box.distanceTo(*viewer) : 0.0f, (unsigned int)i });
+        }
+        if (viewer != NULL)
+            std::sort(drawOrder.begin(), drawOrder.end());
+
+        bool changed = false;
+        size_t visible = 0;
+        for (const DrawOrder& order : drawOrder)
+        {
+            const BatchInstance& instance = allInstances[order.item];
+            if (visible == visibleInstances.size())
+            {
+                visibleInstances.push_back(instance);
+                changed = true;
+            }
+            else if (std::memcmp(&visibleInstances[visible], &instance, sizeof(BatchInstance)) != 0)
+            {
+                visibleInstances[visible] = instance;
+                changed = true;
+            }
+            visible++;
+        }
+        if (visible != uploadedInstances)
+            changed = true;
+        visibleInstances.resize(visible);
+
+        if (changed && visible > 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, visible * sizeof(BatchInstance), visibleInstances.data());
+        }
+        uploadedInstances = visible;
+        instanceCount = (GLsizei)visible;
+        counters.tested += (int)allInstances.size();
+        counters.culled += (int)(allInstances.size() - visible);
+        return (int)visible;
+    }
+};
+
+#endif /* static_batch_h */
@@ -0,0 +1,148 @@
+#ifndef texture_array_h
+#define texture_array_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include "shader.h"
+#include "render_state.h"
+
+// The scene's 2D textures copied into the layers of one GL_TEXTURE_2D_ARRAY,
+// so geometry that used to be split by glBindTexture can be drawn together
+// with the layer as a vertex attribute. Every layer wraps on its own, the
+// GL_REPEAT tiling of floors and walls needs no UV rewriting.
+//
+// Layers are square, as large as the largest texture up to maxLayerSize;
+// bigger textures are box filtered down, smaller ones stretched bilinearly.
+// The copy renders each texture into its layer, which works for any source
+// format, block compressed included, so it has to wait until the images have
+// been uploaded.
+class TextureArray {
+public:
+    static const int maxLayerSize = 1024;
+
+    ~TextureArray()
+    {
+        if (array != 0)
+        {
+            RenderState::current().forgetTexture(array);
+            glDeleteTextures(1, &array);
+        }
+    }
+
+    // copies textures (duplicates are packed once) into a new array, replacing
+    // what was packed before
+    void pack(const std::vector<GLuint>& textures)
+    {
+        layers.clear();
+        for (GLuint texture : textures)
+            if (std::find(layers.begin(), layers.end(), texture) == layers.end())
+                layers.push_back(texture);
+        if (layers.empty())
+            return;
+
+        std::vector<GLint> widths(layers.size()), heights(layers.size());
+        size = 1;
+        for (size_t layer = 0; layer < layers.size(); layer++)
+        {
+            bindTexture(GL_TEXTURE_2D, layers[layer]);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &widths[layer]);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &heights[layer]);
+            while (size < maxLayerSize && (size < widths[layer] || size < heights[layer]))
+                size *= 2;
+        }
+
+        if (array == 0)
+            glGenTextures(1, &array);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size, size, (GLsizei)layers.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        // the sampler every scene texture is loaded with
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        GLint previousFramebuffer, viewport[4];
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+        GLboolean blend = glIsEnabled(GL_BLEND);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_BLEND);
+
+        GLuint framebuffer, emptyVAO;
+        glGenFramebuffers(1, &framebuffer);
+        glGenVertexArrays(1, &emptyVAO);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        glViewport(0, 0, size, size);
+        Shader packShader("packVertexShader.vs", "packFragmentShader.fs");
+        packShader.use();
+        packShader.setInt("source", 0);
+        packShader.setVec2("layerSize", glm::vec2((float)size));
+        bindVertexArray(emptyVAO);
+        activeTexture(GL_TEXTURE0);
+        for (size_t layer = 0; layer < layers.size(); layer++)
+        {
+            glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, array, 0, (GLint)layer);
+            bindTexture(GL_TEXTURE_2D, layers[layer]);
+            packShader.setVec2("taps", glm::vec2((float)tapsFor(widths[layer]), (float)tapsFor(heights[layer])));
+            drawArrays(GL_TRIANGLES, 0, 3);
+        }
+
+        bindVertexArray(0);
+        deleteVertexArrays(1, &emptyVAO);
+        useProgram(0);
+        deleteProgram(packShader.ID);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousFramebuffer);
+        glDeleteFramebuffers(1, &framebuffer);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        if (depthTest)
+            glEnable(GL_DEPTH_TEST);
+        if (blend)
+            glEnable(GL_BLEND);
+    }
+
+    // layer holding texture, -1 if it was not packed
+    int layerOf(GLuint texture) const
+    {
+        for (size_t layer = 0; layer < layers.size(); layer++)
+            if (layers[layer] == texture)
+                return (int)layer;
+        return -1;
+    }
+
+    GLuint texture() const
+    {
+        return array;
+    }
+
+    int layerCount() const
+    {
+        return (int)layers.size();
+    }
+
+    int layerSize() const
+    {
+        return size;
+    }
+
+    size_t bytes() const
+    {
+        return (size_t)size * size * 4 * layers.size();
+    }
+
+private:
+    GLuint array = 0;
+    int size = 0;
+    // the 2D texture copied into each layer
+    std::vector<GLuint> layers;
+
+    // source texels averaged per layer texel along one axis
+    int tapsFor(int sourceSize) const
+    {
+        return std::max(1, std::min(4, (sourceSize + size - 1) / size));
+    }
+};
+
+#endif /* texture_array_h */
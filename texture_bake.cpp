@@ -0,0 +1,319 @@
+// texture_bake: converts the scene's images into .htex containers (see htex.h)
+// next to them, so the viewer uploads ready-made, block compressed mip chains
+// instead of decoding the images and building the mipmaps at every start.
+//
+//     texture_bake [--uncompressed] image...
+//
+// --uncompressed keeps the levels as plain 8 bit pixels, for drivers without
+// S3TC. Images are re-baked whenever this is run; the viewer falls back to the
+// image itself for anything without a .htex.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <iostream>
+#include "stb_image.h"
+#include "htex.h"
+
+struct Image {
+    int width;
+    int height;
+    int channels;
+    std::vector<unsigned char> pixels;
+};
+
+// next mip level, averaging 2x2 texels, with the last row or column of an odd
+// sized level folded into its neighbour: the texels of the last row and column
+// of the new level average 3 texels across instead of 2
+static Image downsample(const Image& source)
+{
+    Image half;
+    half.width = source.width > 1 ? source.width / 2 : 1;
+    half.height = source.height > 1 ? source.height / 2 : 1;
+    half.channels = source.channels;
+    half.pixels.resize((size_t)half.width * half.height * half.channels);
+    for (int y = 0; y < half.height; y++)
+    {
+        int y0 = std::min(y * 2, source.height - 1);
+        int y1 = y == half.height - 1 ? source.height - 1 : y * 2 + 1;
+        for (int x = 0; x < half.width; x++)
+        {
+            int x0 = std::min(x * 2, source.width - 1);
+            int x1 = x == half.width - 1 ? source.width - 1 : x * 2 + 1;
+            int count = (y1 - y0 + 1) * (x1 - x0 + 1);
+            for (int c = 0; c < source.channels; c++)
+            {
+                int sum = 0;
+                for (int sy = y0; sy <= y1; sy++)
+                    for (int sx = x0; sx <= x1; sx++)
+                        sum += source.pixels[((size_t)sy * source.width + sx) * source.channels + c];
+                half.pixels[((size_t)y * half.width + x) * half.channels + c] = (unsigned char)((sum + count / 2) / count);
+            }
+        }
+    }
+    return half;
+}
+
+static unsigned short packColor(const float color[3])
+{
+    int r = (int)(std::max(0.0f, std::min(255.0f, color[0])) * 31.0f / 255.0f + 0.5f);
+    int g = (int)(std::max(0.0f, std::min(255.0f, color[1])) * 63.0f / 255.0f + 0.5f);
+    int b = (int)(std::max(0.0f, std::min(255.0f, color[2])) * 31.0f / 255.0f + 0.5f);
+    return (unsigned short)((r << 11) | (g << 5) | b);
+}
+
+static void unpackColor(unsigned short packed, int color[3])
+{
+    int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+// BC1 color half of a block: the endpoints are the extremes of the texels
+// along their principal axis, every texel takes the nearest of the 4 colors
+static void encodeColors(const unsigned char block[16][4], unsigned char* out)
+{
+    float mean[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 3; c++)
+            mean[c] += block[i][c] / 16.0f;
+    float covariance[6] = { 0, 0, 0, 0, 0, 0 };
+    for (int i = 0; i < 16; i++)
+    {
+        float r = block[i][0] - mean[0], g = block[i][1] - mean[1], b = block[i][2] - mean[2];
+        covariance[0] += r * r; covariance[1] += r * g; covariance[2] += r * b;
+        covariance[3] += g * g; covariance[4] += g * b; covariance[5] += b * b;
+    }
+    float axis[3] = { 1, 1, 1 };
+    for (int iteration = 0; iteration < 8; iteration++)
+    {
+        float x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+        float y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+        float z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+        float length = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+        if (length < 1e-6f)
+            break;
+        axis[0] = x / length; axis[1] = y / length; axis[2] = z / length;
+    }
+    float low = 1e30f, high = -1e30f;
+    for (int i = 0; i < 16; i++)
+    {
+        float t = (block[i][0] - mean[0]) * axis[0] + (block[i][1] - mean[1]) * axis[1] + (block[i][2] - mean[2]) * axis[2];
+        low = std::min(low, t);
+        high = std::max(high, t);
+    }
+    float lengthSquared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    float minColor[3], maxColor[3];
+    for (int c = 0; c < 3; c++)
+    {
+        minColor[c] = mean[c] + axis[c] * low / lengthSquared;
+        maxColor[c] = mean[c] + axis[c] * high / lengthSquared;
+    }
+
+    unsigned short color0 = packColor(maxColor);
+    unsigned short color1 = packColor(minColor);
+    // color0 > color1 selects the 4 color mode, without a transparent index
+    if (color0 < color1)
+        std::swap(color0, color1);
+    unsigned int indices = 0;
+    if (color0 != color1)
+    {
+        int palette[4][3];
+        unpackColor(color0, palette[0]);
+        unpackColor(color1, palette[1]);
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0, bestDistance = 1 << 30;
+            for (int p = 0; p < 4; p++)
+            {
+                int r = block[i][0] - palette[p][0], g = block[i][1] - palette[p][1], b = block[i][2] - palette[p][2];
+                int distance = r * r + g * g + b * b;
+                if (distance < bestDistance)
+                {
+                    best = p;
+                    bestDistance = distance;
+                }
+            }
+            indices |= (unsigned int)best << (i * 2);
+        }
+    }
+    out[0] = color0 & 0xff; out[1] = color0 >> 8;
+    out[2] = color1 & 0xff; out[3] = color1 >> 8;
+    for (int i = 0; i < 4; i++)
+        out[4 + i] = (indices >> (i * 8)) & 0xff;
+}
+
+// BC3 alpha half: the block's alpha range in 8 steps
+static void encodeAlpha(const unsigned char block[16][4], unsigned char* out)
+{
+    int alpha0 = 0, alpha1 = 255;
+    for (int i = 0; i < 16; i++)
+    {
+        alpha0 = std::max(alpha0, (int)block[i][3]);
+        alpha1 = std::min(alpha1, (int)block[i][3]);
+    }
+    unsigned long long indices = 0;
+    if (alpha0 != alpha1)
+    {
+        int palette[8] = { alpha0, alpha1 };
+        for (int p = 1; p < 7; p++)
+            palette[p + 1] = ((7 - p) * alpha0 + p * alpha1) / 7;
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0;
+            for (int p = 1; p < 8; p++)
+                if (std::abs(block[i][3] - palette[p]) < std::abs(block[i][3] - palette[best]))
+                    best = p;
+            indices |= (unsigned long long)best << (i * 3);
+        }
+    }
+    out[0] = (unsigned char)alpha0;
+    out[1] = (unsigned char)alpha1;
+    for (int i = 0; i < 6; i++)
+        out[2 + i] = (indices >> (i * 8)) & 0xff;
+}
+
+static void compress(const Image& image, HtexFormat format, std::vector<unsigned char>& out)
+{
+    for (int by = 0; by < image.height; by += 4)
+        for (int bx = 0; bx < image.width; bx += 4)
+        {
+            // blocks over the edge of a small level repeat its last texels
+            unsigned char block[16][4];
+            for (int i = 0; i < 16; i++)
+            {
+                int x = std::min(bx + i % 4, image.width - 1);
+                int y = std::min(by + i / 4, image.height - 1);
+                const unsigned char* texel = &image.pixels[((size_t)y * image.width + x) * image.channels];
+                for (int c = 0; c < 4; c++)
+                    block[i][c] = c < image.channels ? texel[c] : 255;
+            }
+            unsigned char encoded[16];
+            if (format == HTEX_BC3)
+            {
+                encodeAlpha(block, encoded);
+                encodeColors(block, encoded + 8);
+                out.insert(out.end(), encoded, encoded + 16);
+            }
+            else
+            {
+                encodeColors(block, encoded);
+                out.insert(out.end(), encoded, encoded + 8);
+            }
+        }
+}
+
+static const char* formatName(uint32_t format)
+{
+    return format == HTEX_BC1 ? "BC1" : format == HTEX_BC3 ? "BC3" : "uncompressed";
+}
+
+static bool bake(const char* path, bool uncompressed)
+{
+    Image image;
+    unsigned char* pixels = stbi_load(path, &image.width, &image.height, &image.channels, 0);
+    if (pixels == NULL)
+    {
+        std::cout << path << ": " << stbi_failure_reason() << std::endl;
+        return false;
+    }
+    image.pixels.assign(pixels, pixels + (size_t)image.width * image.height * image.channels);
+    stbi_image_free(pixels);
+
+    HtexFormat format = HTEX_UNCOMPRESSED;
+    if (!uncompressed && image.channels >= 3)
+    {
+        format = HTEX_BC1;
+        if (image.channels == 4)
+            for (size_t i = 3; i < image.pixels.size(); i += 4)
+                if (image.pixels[i] != 255)
+                    format = HTEX_BC3;
+    }
+
+    HtexHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "HTEX", 4);
+    header.version = htexVersion;
+    header.format = format;
+    header.channels = image.channels;
+    header.width = image.width;
+    header.height = image.height;
+
+    std::vector<unsigned char> body;
+    size_t offset = sizeof(HtexHeader);
+    while (true)
+    {
+        std::vector<unsigned char> level;
+        if (format == HTEX_UNCOMPRESSED)
+            level = image.pixels;
+        else
+            compress(image, format, level);
+        header.level[header.levels].offset = (uint32_t)offset;
+        header.level[header.levels].size = (uint32_t)level.size();
+        header.levels++;
+        body.insert(body.end(), level.begin(), level.end());
+        offset += level.size();
+        while (offset % 16 != 0)
+        {
+            body.push_back(0);
+            offset++;
+        }
+        if ((image.width == 1 && image.height == 1) || header.levels == HtexHeader::maxLevels)
+            break;
+        image = downsample(image);
+    }
+
+    std::string bakedPath = htexPath(path);
+    FILE* file = fopen(bakedPath.c_str(), "wb");
+    if (file == NULL)
+    {
+        std::cout << bakedPath << ": cannot write" << std::endl;
+        return false;
+    }
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(body.data(), 1, body.size(), file) == body.size();
+    fclose(file);
+    if (!written)
+    {
+        std::cout << bakedPath << ": write failed" << std::endl;
+        return false;
+    }
+    std::cout << path << " -> " << bakedPath << ": " << header.width << "x" << header.height << " " << formatName(format) << ", "
+        << header.levels << " levels, " << (sizeof(header) + body.size()) / 1024 << " KB" << std::endl;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    bool uncompressed = false;
+    int baked = 0, failed = 0;
+    // same orientation as TextureLoader's flipped loads
+    stbi_set_flip_vertically_on_load(true);
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--uncompressed") == 0)
+        {
+            uncompressed = true;
+            continue;
+        }
+        if (bake(argv[i], uncompressed))
+            baked++;
+        else
+            failed++;
+    }
+    if (baked + failed == 0)
+    {
+        std::cout << "usage: texture_bake [--uncompressed] image..." << std::endl;
+        return 1;
+    }
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+#ifndef texture_loader_h
+#define texture_loader_h
+
+#include <glad/glad.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstring>
+#include <iostream>
+#include "stb_image.h"
+#include "htex.h"
+#include "texture_streamer.h"
+#include "render_state.h"
+
+// Image files decoded on worker threads and uploaded on the GL thread.
+// request() returns the GL texture straight away, holding a single grey
+// placeholder texel until its image is in, so scene setup can keep going
+// while the files decode. update() runs once a frame and uploads what the
+// workers have finished since, a few textures per frame so no one frame pays
+// for all of them.
+//
+// An image with a baked .htex next to it (see texture_bake.cpp) skips all of
+// that: the worker only maps the file and the upload hands its mip levels,
+// block compressed when the driver has S3TC, straight to GL. With a streamer
+// set, the mapped file then goes to it so it can trade levels in and out.
+//
+// The job list is fixed once start() runs. Workers claim jobs through an
+// atomic counter and publish decoded pixels by setting the job's ready flag,
+// which is all the GL thread looks at, so neither side ever takes a lock.
+class TextureLoader {
+public:
+    struct Sampler {
+        GLenum wrapS;
+        GLenum wrapT;
+        GLenum minFilter;
+        GLenum magFilter;
+    };
+
+    ~TextureLoader()
+    {
+        for (std::thread& worker : workers)
+            worker.join();
+        for (Job& job : jobs)
+            stbi_image_free(job.pixels);
+    }
+
+    // format GL_RGB or GL_RGBA converts the image to that many channels,
+    // 0 keeps whatever the file has. Workers index the job list without a
+    // lock, so after start() a request is refused and gets a black texture.
+    GLuint request(const std::string& path, GLenum format, const Sampler& sampler)
+    {
+        if (started)
+        {
+            std::cout << "Texture " << path << " requested after loading started, drawing it black" << std::endl;
+            GLuint texture;
+            glGenTextures(1, &texture);
+            bindTexture(GL_TEXTURE_2D, texture);
+            const unsigned char black[4] = { 0, 0, 0, 255 };
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, black);
+            return texture;
+        }
+        Job job;
+        job.path = path;
+        job.format = format;
+        glGenTextures(1, &job.texture);
+        bindTexture(GL_TEXTURE_2D, job.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, sampler.wrapS);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, sampler.wrapT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, sampler.minFilter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, sampler.magFilter);
+        const unsigned char placeholder[4] = { 128, 128, 128, 255 };
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+        GLuint texture = job.texture;
+        jobs.push_back(std::move(job));
+        return texture;
+    }
+
+    // takes every texture uploaded from a .htex from now on
+    void setStreamer(TextureStreamer* streamer)
+    {
+        this->streamer = streamer;
+    }
+
+    // starts decoding everything requested so far
+    void start()
+    {
+        started = true;
+        compressionSupported = hasExtension("GL_EXT_texture_compression_s3tc");
+        ready = std::vector<std::atomic<bool>>(jobs.size());
+        unsigned int threads = std::thread::hardware_concurrency();
+        threads = threads > 1 ? threads - 1 : 1;
+        if (threads > jobs.size())
+            threads = (unsigned int)jobs.size();
+        for (unsigned int i = 0; i < threads; i++)
+            workers.push_back(std::thread(&TextureLoader::work, this));
+    }
+
+    // uploads at most maxUploads decoded images, false once every one is in
+    bool update(int maxUploads = 4)
+    {
+        if (uploaded == jobs.size())
+            return false;
+        for (size_t i = 0; i < jobs.size() && maxUploads > 0; i++)
+        {
+            if (jobs[i].done || !ready[i].load(std::memory_order_acquire))
+                continue;
+            upload(jobs[i]);
+            maxUploads--;
+        }
+        return uploaded < jobs.size();
+    }
+
+    // blocks until every requested image has been uploaded
+    void finish()
+    {
+        while (update(0x7fffffff))
+            std::this_thread::yield();
+    }
+
+    // request() only takes new images until this is true
+    bool isStarted() const
+    {
+        return started;
+    }
+
+    // whether texture was requested and is still waiting for its image
+    bool pending(GLuint texture) const
+    {
+        for (const Job& job : jobs)
+            if (job.texture == texture)
+                return !job.done;
+        return false;
+    }
+
+    int threadCount() const
+    {
+        return (int)workers.size();
+    }
+
+    // images that came from a .htex instead of being decoded
+    int bakedCount() const
+    {
+        return baked;
+    }
+
+    // video memory of the uploaded textures with their mipmaps, counting RGB
+    // as the RGBA drivers store it
+    size_t textureBytes() const
+    {
+        return bytes;
+    }
+
+private:
+    struct Job {
+        std::string path;
+        GLuint texture = 0;
+        GLenum format = 0;
+        unsigned char* pixels = NULL;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        bool done = false;
+        std::unique_ptr<HtexFile> baked;
+    };
+
+    std::vector<Job> jobs;
+    std::vector<std::atomic<bool>> ready;
+    std::atomic<size_t> nextJob{ 0 };
+    std::vector<std::thread> workers;
+    size_t uploaded = 0;
+    bool started = false;
+    bool compressionSupported = false;
+    TextureStreamer* streamer = NULL;
+    int baked = 0;
+    size_t bytes = 0;
+
+    static bool hasExtension(const char* name)
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+            if (std::strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), name) == 0)
+                return true;
+        return false;
+    }
+
+    // the baked file is only used when it samples the same as the decoded
+    // image would: stb_image expands grey to the asked RGB(A), and an image
+    // asked for as RGB has no alpha
+    bool openBaked(Job& job)
+    {
+        std::unique_ptr<HtexFile> file(new HtexFile());
+        if (!file->open(htexPath(job.path)))
+            return false;
+        const HtexHeader& header = file->header();
+        if (header.format != HTEX_UNCOMPRESSED && !compressionSupported)
+            return false;
+        if (job.format != 0 && header.channels < 3)
+            return false;
+        if (job.format == GL_RGB && header.channels == 4)
+            return false;
+        job.baked = std::move(file);
+        return true;
+    }
+
+    void work()
+    {
+        stbi_set_flip_vertically_on_load_thread(true);
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            Job& job = jobs[i];
+            if (openBaked(job))
+            {
+                ready[i].store(true, std::memory_order_release);
+                continue;
+            }
+            int wanted = job.format == GL_RGBA ? 4 : job.format == GL_RGB ? 3 : 0;
+            job.pixels = stbi_load(job.path.c_str(), &job.width, &job.height, &job.channels, wanted);
+            if (wanted != 0)
+                job.channels = wanted;
+            ready[i].store(true, std::memory_order_release);
+        }
+    }
+
+    void upload(Job& job)
+    {
+        job.done = true;
+        uploaded++;
+        bindTexture(GL_TEXTURE_2D, job.texture);
+        if (job.baked)
+        {
+            uploadBaked(*job.baked);
+            if (streamer != NULL)
+                streamer->adopt(job.texture, std::move(job.baked));
+            job.baked.reset();
+            return;
+        }
+        if (job.pixels == NULL)
+        {
+            // black, as an image that never got its pixels has always sampled
+            std::cout << "Texture failed to load at path: " << job.path << std::endl;
+            const unsigned char missing[4] = { 0, 0, 0, 255 };
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, missing);
+            return;
+        }
+
+        GLenum format = job.channels == 1 ? GL_RED : job.channels == 2 ? GL_RG : job.channels == 4 ? GL_RGBA : GL_RGB;
+        // stb_image rows are tightly packed, GL would otherwise expect them
+        // padded to 4 bytes and read past the end of odd sized RGB images
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, format, job.width, job.height, 0, format, GL_UNSIGNED_BYTE, job.pixels);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        stbi_image_free(job.pixels);
+        job.pixels = NULL;
+        bytes += (size_t)job.width * job.height * (job.channels == 3 ? 4 : job.channels) * 4 / 3;
+    }
+
+    void uploadBaked(const HtexFile& file)
+    {
+        const HtexHeader& header = file.header();
+        GLenum format = header.channels == 1 ? GL_RED : header.channels == 2 ? GL_RG : header.channels == 4 ? GL_RGBA : GL_RGB;
+        GLenum compressed = header.format == HTEX_BC1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GLsizei width = header.width, height = header.height;
+        for (uint32_t level = 0; level < header.levels; level++)
+        {
+            if (header.format == HTEX_UNCOMPRESSED)
+                glTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, format, GL_UNSIGNED_BYTE, file.levelData(level));
+            else
+                glCompressedTexImage2D(GL_TEXTURE_2D, level, compressed, width, height, 0, header.level[level].size, file.levelData(level));
+            bytes += header.format == HTEX_UNCOMPRESSED ? (size_t)width * height * (header.channels == 3 ? 4 : header.channels) : header.level[level].size;
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, header.levels - 1);
+        baked++;
+    }
+};
+
+#endif /* texture_loader_h */
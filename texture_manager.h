@@ -0,0 +1,188 @@
+#ifndef texture_manager_h
+#define texture_manager_h
+
+#include <glad/glad.h>
+#include <cctype>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "texture_loader.h"
+#include "render_state.h"
+
+// Every texture of the scene, loaded once per image and sampler. The scene
+// refers to textures by name: acquire() registers a name for an image file,
+// and when the same file (paths compare the way Windows opens them, case and
+// slash direction don't matter) was already acquired with the same format and
+// sampler, the name shares that texture and it counts one more user instead of
+// decoding and uploading the image again. release() drops a user and deletes
+// the texture with its last one, or once the loader has uploaded it when it
+// is still in flight (see collect()).
+//
+// get() never hands out an ID that was not made by the manager: a name that
+// was never acquired answers with a black texture, reported once.
+class TextureManager {
+public:
+    explicit TextureManager(TextureLoader& loader) : loader(loader) {}
+
+    GLuint acquire(const std::string& name, const std::string& path, GLenum format, const TextureLoader::Sampler& sampler)
+    {
+        // every image has to be requested before the loader starts
+        if (loader.isStarted())
+        {
+            std::cout << "Texture \"" << name << "\" acquired after loading started, drawing it black" << std::endl;
+            return missingTexture();
+        }
+
+        // a name acquired again moves to the new image and leaves the old one
+        auto named = names.find(name);
+        if (named != names.end())
+        {
+            GLuint previous = named->second;
+            names.erase(named);
+            release(previous);
+        }
+
+        std::string key = makeKey(path, format, sampler);
+        Entry* entry = NULL;
+        for (Entry& candidate : entries)
+            if (candidate.key == key)
+                entry = &candidate;
+        if (entry == NULL)
+        {
+            entries.push_back({ key, loader.request(path, format, sampler), 0 });
+            entry = &entries.back();
+        }
+        entry->users++;
+        requests++;
+        names[name] = entry->texture;
+        return entry->texture;
+    }
+
+    // Deleting a texture that is still waiting on the loader would let the
+    // upload recreate it, so one released in flight is only retired here and
+    // deleted by collect().
+    void release(GLuint texture)
+    {
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            if (entries[i].texture != texture)
+                continue;
+            if (--entries[i].users > 0)
+                return;
+            dropNames(texture);
+            entries.erase(entries.begin() + i);
+            if (loader.pending(texture))
+                retired.push_back(texture);
+            else
+                deleteTextures(1, &texture);
+            return;
+        }
+    }
+
+    // deletes the retired textures the loader is done with, call after its
+    // update()
+    void collect()
+    {
+        for (size_t i = 0; i < retired.size();)
+        {
+            if (loader.pending(retired[i]))
+            {
+                i++;
+                continue;
+            }
+            deleteTextures(1, &retired[i]);
+            retired.erase(retired.begin() + i);
+        }
+    }
+
+    // releases every name, for shutdown
+    void clear()
+    {
+        for (const Entry& entry : entries)
+            deleteTextures(1, &entry.texture);
+        if (!retired.empty())
+            deleteTextures((GLsizei)retired.size(), retired.data());
+        entries.clear();
+        retired.clear();
+        names.clear();
+        if (missing != 0)
+            deleteTextures(1, &missing);
+        missing = 0;
+    }
+
+    GLuint get(const char* name)
+    {
+        auto named = names.find(name);
+        if (named != names.end())
+            return named->second;
+        std::cout << "Unknown texture \"" << name << "\", drawing it black" << std::endl;
+        GLuint texture = missingTexture();
+        names[name] = texture;
+        return texture;
+    }
+
+    // textures actually loaded, against the acquire() calls they serve
+    int textureCount() const
+    {
+        return (int)entries.size();
+    }
+
+    int requestCount() const
+    {
+        return requests;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        GLuint texture;
+        int users;
+    };
+
+    TextureLoader& loader;
+    std::vector<Entry> entries;
+    std::vector<GLuint> retired;
+    std::map<std::string, GLuint, std::less<>> names;
+    GLuint missing = 0;
+    int requests = 0;
+
+    static std::string makeKey(const std::string& path, GLenum format, const TextureLoader::Sampler& sampler)
+    {
+        std::string key;
+        for (char c : path)
+            key += c == '\\' ? '/' : (char)std::tolower((unsigned char)c);
+        while (key.compare(0, 2, "./") == 0)
+            key.erase(0, 2);
+        key += '|' + std::to_string(format) + '|' + std::to_string(sampler.wrapS) + '|' + std::to_string(sampler.wrapT)
+            + '|' + std::to_string(sampler.minFilter) + '|' + std::to_string(sampler.magFilter);
+        return key;
+    }
+
+    void dropNames(GLuint texture)
+    {
+        for (auto named = names.begin(); named != names.end();)
+        {
+            if (named->second == texture)
+                named = names.erase(named);
+            else
+                ++named;
+        }
+    }
+
+    GLuint missingTexture()
+    {
+        if (missing != 0)
+            return missing;
+        glGenTextures(1, &missing);
+        bindTexture(GL_TEXTURE_2D, missing);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        const unsigned char black[4] = { 0, 0, 0, 255 };
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, black);
+        return missing;
+    }
+};
+
+#endif /* texture_manager_h */
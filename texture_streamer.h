@@ -0,0 +1,296 @@
+#ifndef texture_streamer_h
+#define texture_streamer_h
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include "htex.h"
+#include "frustum.h"
+#include "render_state.h"
+
+// EXT_texture_compression_s3tc, not part of the 3.3 core glad is generated for
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+// Keeps only the mip levels of each baked texture that the camera can make
+// use of, within a video memory budget. The loader hands over every texture
+// it uploaded from a .htex together with the mapped file, so any level can be
+// brought back without decoding anything.
+//
+// Each frame the draws report the textures they sample (as the RenderState
+// draw listener). A draw that announced its world box with nextDrawCovers()
+// asks for the level whose texels are about pixel sized at its distance from
+// the camera; a draw without a box asks for the full texture. Textures not
+// drawn for a while fall back to their smallest level. update() then works
+// out the levels for the next frame: the wanted ones, made coarser one level
+// at a time on the largest texture while they do not fit the budget, and
+// re-specifies at most a few textures per frame from the mapped file.
+//
+// Evicting the top levels of a texture makes the next level its level 0, so
+// the GL texture keeps its name and everything bound to it keeps working.
+class TextureStreamer : public DrawListener {
+public:
+    // textures not drawn for this many frames drop to their smallest level
+    static const int unusedFrames = 120;
+    // texture re-uploads per update()
+    static const int changesPerFrame = 2;
+
+    explicit TextureStreamer(size_t budgetBytes = 256 * 1024 * 1024) : budget(budgetBytes) {}
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    void setBudget(size_t budgetBytes)
+    {
+        budget = budgetBytes;
+    }
+
+    // texture was just uploaded from file with all its levels
+    void adopt(GLuint texture, std::unique_ptr<HtexFile> file)
+    {
+        Slot slot;
+        slot.texture = texture;
+        slot.file = std::move(file);
+        const HtexHeader& header = slot.file->header();
+        slot.levels = (int)header.levels;
+        slot.size = (float)std::max(header.width, header.height);
+        slot.resident = 0;
+        slot.wanted = 0;
+        slot.lastUsed = frame;
+        if (texture >= slotOf.size())
+            slotOf.resize(texture + 1, -1);
+        slotOf[texture] = (int)slots.size();
+        slots.push_back(std::move(slot));
+        fullBytes += chainBytes(slots.back(), 0);
+        residentBytes += chainBytes(slots.back(), 0);
+    }
+
+    // only once enabled do draws count and update() change anything, so
+    // textures can still be copied at full size beforehand
+    void enable()
+    {
+        enabled = true;
+        for (Slot& slot : slots)
+            slot.lastUsed = frame;
+    }
+
+    // camera for the frame about to be drawn; pixelsPerUnit is how many
+    // pixels one world unit covers at distance 1
+    void beginFrame(const glm::vec3& cameraPosition, float pixelsPerUnit)
+    {
+        camera = cameraPosition;
+        this->pixelsPerUnit = pixelsPerUnit;
+        frame++;
+        for (Slot& slot : slots)
+            slot.need = (float)slot.levels;
+        pendingBox = false;
+    }
+
+    // whether nextDrawCovers() is worth working out a box for
+    bool wantsBoxes() const
+    {
+        return enabled && !slots.empty();
+    }
+
+    // the next draw covers box (world space)
+    void nextDrawCovers(const BoundingBox& box)
+    {
+        if (!wantsBoxes())
+            return;
+        nextBox = box;
+        pendingBox = true;
+    }
+
+    void drawn(GLuint texture) override
+    {
+        bool spatial = pendingBox;
+        pendingBox = false;
+        if (!enabled || texture >= slotOf.size() || slotOf[texture] < 0)
+            return;
+        Slot& slot = slots[slotOf[texture]];
+        slot.lastUsed = frame;
+        slot.need = std::min(slot.need, spatial ? levelFor(slot, nextBox) : 0.0f);
+    }
+
+    // settles the levels wanted from the frame just drawn and uploads what
+    // changed, a few textures at a time
+    void update()
+    {
+        loadedThisFrame = 0;
+        evictedThisFrame = 0;
+        if (!enabled || slots.empty())
+            return;
+
+        size_t wantedBytes = 0;
+        for (Slot& slot : slots)
+        {
+            if (frame - slot.lastUsed > unusedFrames)
+                slot.wanted = slot.levels - 1;
+            else if (slot.lastUsed == frame)
+                slot.wanted = std::max(0, std::min(slot.levels - 1, (int)std::floor(slot.need)));
+            wantedBytes += chainBytes(slot, slot.wanted);
+        }
+        // over budget the largest wanted texture gives up its top level first
+        while (wantedBytes > budget)
+        {
+            Slot* largest = NULL;
+            for (Slot& slot : slots)
+                if (slot.wanted < slot.levels - 1 && (largest == NULL || levelBytes(slot, slot.wanted) > levelBytes(*largest, largest->wanted)))
+                    largest = &slot;
+            if (largest == NULL)
+                break;
+            wantedBytes -= levelBytes(*largest, largest->wanted);
+            largest->wanted++;
+        }
+
+        // evictions first, they make room for the loads
+        int changes = 0;
+        for (Slot& slot : slots)
+            if (changes < changesPerFrame && slot.wanted > slot.resident)
+            {
+                makeResident(slot, slot.wanted);
+                evictedThisFrame++;
+                changes++;
+            }
+        for (Slot& slot : slots)
+            if (changes < changesPerFrame && slot.wanted < slot.resident && residentBytes - chainBytes(slot, slot.resident) + chainBytes(slot, slot.wanted) <= budget)
+            {
+                makeResident(slot, slot.wanted);
+                loadedThisFrame++;
+                changes++;
+            }
+    }
+
+    int textureCount() const
+    {
+        return (int)slots.size();
+    }
+
+    // video memory the streamed textures take now, and would with every level
+    size_t bytesResident() const
+    {
+        return residentBytes;
+    }
+
+    size_t bytesFull() const
+    {
+        return fullBytes;
+    }
+
+    size_t budgetBytes() const
+    {
+        return budget;
+    }
+
+    // textures whose level 0 is not the full image
+    int texturesReduced() const
+    {
+        int reduced = 0;
+        for (const Slot& slot : slots)
+            if (slot.resident > 0)
+                reduced++;
+        return reduced;
+    }
+
+    int loadsThisFrame() const
+    {
+        return loadedThisFrame;
+    }
+
+    int evictionsThisFrame() const
+    {
+        return evictedThisFrame;
+    }
+
+private:
+    struct Slot {
+        GLuint texture = 0;
+        std::unique_ptr<HtexFile> file;
+        int levels = 0;
+        float size = 0.0f;      // texels along the longer side of level 0
+        int resident = 0;       // file level that is GL level 0 now
+        int wanted = 0;
+        float need = 0.0f;      // finest level a draw asked for this frame
+        long long lastUsed = 0;
+    };
+
+    std::vector<Slot> slots;
+    // GL texture name -> slot, -1 for textures that are not streamed
+    std::vector<int> slotOf;
+    size_t budget;
+    size_t residentBytes = 0;
+    size_t fullBytes = 0;
+    bool enabled = false;
+    long long frame = 0;
+    glm::vec3 camera = glm::vec3(0.0f);
+    float pixelsPerUnit = 1.0f;
+    bool pendingBox = false;
+    BoundingBox nextBox;
+    int loadedThisFrame = 0;
+    int evictedThisFrame = 0;
+
+    // the level with about one texel per pixel on a face of box: the image
+    // spans a face, taken as the box's middle extent so thin walls and
+    // slabs count with their broad side
+    float levelFor(const Slot& slot, const BoundingBox& box) const
+    {
+        glm::vec3 extent = box.max - box.min;
+        float sorted[3] = { extent.x, extent.y, extent.z };
+        std::sort(sorted, sorted + 3);
+        float face = std::max(sorted[1], 0.01f);
+        glm::vec3 closest = glm::min(glm::max(camera, box.min), box.max);
+        float distance = std::max(glm::length(camera - closest), 0.1f);
+        float texelsPerUnit = slot.size / face;
+        float pixelsThere = pixelsPerUnit / distance;
+        return std::log2(std::max(texelsPerUnit / pixelsThere, 1.0f));
+    }
+
+    static size_t levelBytes(const Slot& slot, int level)
+    {
+        return slot.file->header().level[level].size;
+    }
+
+    static size_t chainBytes(const Slot& slot, int top)
+    {
+        size_t bytes = 0;
+        for (int level = top; level < slot.levels; level++)
+            bytes += levelBytes(slot, level);
+        return bytes;
+    }
+
+    // re-specifies the texture from file level top down, and frees the levels
+    // the old chain had beyond the new one
+    void makeResident(Slot& slot, int top)
+    {
+        const HtexHeader& header = slot.file->header();
+        GLenum format = header.channels == 1 ? GL_RED : header.channels == 2 ? GL_RG : header.channels == 4 ? GL_RGBA : GL_RGB;
+        GLenum compressed = header.format == HTEX_BC1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        bindTexture(GL_TEXTURE_2D, slot.texture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GLsizei width = std::max(1u, header.width >> top), height = std::max(1u, header.height >> top);
+        for (int level = top; level < slot.levels; level++)
+        {
+            if (header.format == HTEX_UNCOMPRESSED)
+                glTexImage2D(GL_TEXTURE_2D, level - top, format, width, height, 0, format, GL_UNSIGNED_BYTE, slot.file->levelData(level));
+            else
+                glCompressedTexImage2D(GL_TEXTURE_2D, level - top, compressed, width, height, 0, header.level[level].size, slot.file->levelData(level));
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        for (int level = slot.levels - top; level < slot.levels - slot.resident; level++)
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, slot.levels - 1 - top);
+
+        residentBytes = residentBytes - chainBytes(slot, slot.resident) + chainBytes(slot, top);
+        slot.resident = top;
+    }
+};
+
+#endif /* texture_streamer_h */
@@ -0,0 +1,250 @@
+#ifndef transform_system_h
+#define transform_system_h
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define TRANSFORM_SSE 1
+#endif
+
+// Upper 3x3 of a normal matrix, each column padded to a vec4 the way vertex
+// attributes and std140 blocks want them.
+struct NormalMatrix {
+    glm::vec4 column[3];
+};
+
+// transpose(inverse(mat3(model))) for one matrix. Rotations with the same
+// scale along every axis (every placement in the scene but the stretched
+// boxes) are their own normal matrix up to that scale, so those only divide by
+// it; anything else takes the cofactors. A zero determinant gives zero.
+inline glm::mat3 normalMatrixOf(const glm::mat4& model)
+{
+    glm::vec3 x = glm::vec3(model[0]), y = glm::vec3(model[1]), z = glm::vec3(model[2]);
+    float scale = glm::dot(x, x);
+    float tolerance = 1.0e-5f * scale;
+    if (scale > 0.0f && std::fabs(glm::dot(y, y) - scale) <= tolerance && std::fabs(glm::dot(z, z) - scale) <= tolerance
+        && std::fabs(glm::dot(x, y)) <= tolerance && std::fabs(glm::dot(y, z)) <= tolerance && std::fabs(glm::dot(z, x)) <= tolerance)
+        return glm::mat3(x / scale, y / scale, z / scale);
+    glm::vec3 yz = glm::cross(y, z), zx = glm::cross(z, x), xy = glm::cross(x, y);
+    float determinant = glm::dot(x, yz);
+    if (determinant == 0.0f)
+        return glm::mat3(0.0f);
+    return glm::mat3(yz / determinant, zx / determinant, xy / determinant);
+}
+
+// normals[i] = transpose(inverse(mat3(models[i]))), four matrices at a time.
+// A matrix that flattens everything (zero determinant) gets a zero normal
+// matrix instead of infinities; nothing it draws covers a pixel anyway.
+inline void computeNormalMatrices(const glm::mat4* models, NormalMatrix* normals, size_t count)
+{
+    size_t i = 0;
+#ifdef TRANSFORM_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        // m[c][r]: element r of column c, for the four matrices side by side
+        __m128 m[3][3];
+        for (int c = 0; c < 3; c++)
+        {
+            __m128 a = _mm_loadu_ps(&models[i][c][0]);
+            __m128 b = _mm_loadu_ps(&models[i + 1][c][0]);
+            __m128 d = _mm_loadu_ps(&models[i + 2][c][0]);
+            __m128 e = _mm_loadu_ps(&models[i + 3][c][0]);
+            _MM_TRANSPOSE4_PS(a, b, d, e);
+            m[c][0] = a;
+            m[c][1] = b;
+            m[c][2] = d;
+        }
+        // cofactors, which are transpose(inverse) times the determinant
+        __m128 n[3][3];
+        n[0][0] = _mm_sub_ps(_mm_mul_ps(m[1][1], m[2][2]), _mm_mul_ps(m[2][1], m[1][2]));
+        n[0][1] = _mm_sub_ps(_mm_mul_ps(m[2][0], m[1][2]), _mm_mul_ps(m[1][0], m[2][2]));
+        n[0][2] = _mm_sub_ps(_mm_mul_ps(m[1][0], m[2][1]), _mm_mul_ps(m[2][0], m[1][1]));
+        n[1][0] = _mm_sub_ps(_mm_mul_ps(m[2][1], m[0][2]), _mm_mul_ps(m[0][1], m[2][2]));
+        n[1][1] = _mm_sub_ps(_mm_mul_ps(m[0][0], m[2][2]), _mm_mul_ps(m[2][0], m[0][2]));
+        n[1][2] = _mm_sub_ps(_mm_mul_ps(m[2][0], m[0][1]), _mm_mul_ps(m[0][0], m[2][1]));
+        n[2][0] = _mm_sub_ps(_mm_mul_ps(m[0][1], m[1][2]), _mm_mul_ps(m[1][1], m[0][2]));
+        n[2][1] = _mm_sub_ps(_mm_mul_ps(m[1][0], m[0][2]), _mm_mul_ps(m[0][0], m[1][2]));
+        n[2][2] = _mm_sub_ps(_mm_mul_ps(m[0][0], m[1][1]), _mm_mul_ps(m[1][0], m[0][1]));
+        __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][0], n[0][0]), _mm_mul_ps(m[0][1], n[0][1])), _mm_mul_ps(m[0][2], n[0][2]));
+        __m128 nonZero = _mm_cmpneq_ps(determinant, _mm_setzero_ps());
+        __m128 scale = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), determinant), nonZero);
+        for (int c = 0; c < 3; c++)
+        {
+            __m128 x = _mm_mul_ps(n[c][0], scale);
+            __m128 y = _mm_mul_ps(n[c][1], scale);
+            __m128 z = _mm_mul_ps(n[c][2], scale);
+            __m128 w = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(&normals[i].column[c][0], x);
+            _mm_storeu_ps(&normals[i + 1].column[c][0], y);
+            _mm_storeu_ps(&normals[i + 2].column[c][0], z);
+            _mm_storeu_ps(&normals[i + 3].column[c][0], w);
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        glm::mat3 n = normalMatrixOf(models[i]);
+        for (int c = 0; c < 3; c++)
+            normals[i].column[c] = glm::vec4(n[c], 0.0f);
+    }
+}
+
+// Placements of the objects drawn every frame, kept as translation, rotation
+// (a unit quaternion) and scale in structure-of-arrays form. Setting a
+// component to the value it already has changes nothing; anything else marks
+// the object dirty, and update() recomposes the world matrix,
+// translate * rotate * scale, for the dirty objects only, four objects per SSE
+// register lane.
+class TransformSystem {
+public:
+    int add()
+    {
+        int id = count++;
+        // whole groups of four, so update() never reads past the arrays
+        size_t padded = (size_t)((count + 3) & ~3);
+        if (px.size() < padded)
+        {
+            for (std::vector<float>* component : { &px, &py, &pz, &qx, &qy, &qz })
+                component->resize(padded, 0.0f);
+            for (std::vector<float>* component : { &qw, &sx, &sy, &sz })
+                component->resize(padded, 1.0f);
+            dirty.resize(padded, 0);
+            worlds.resize(padded, glm::mat4(1.0f));
+        }
+        dirty[id] = 1;
+        return id;
+    }
+
+    void setTranslation(int id, const glm::vec3& translation)
+    {
+        assign(px[id], translation.x, id);
+        assign(py[id], translation.y, id);
+        assign(pz[id], translation.z, id);
+    }
+
+    // angle in degrees about axis, like glm::rotate
+    void setRotation(int id, float angle, const glm::vec3& axis)
+    {
+        float half = glm::radians(angle) * 0.5f;
+        glm::vec3 unit = glm::normalize(axis) * std::sin(half);
+        assign(qx[id], unit.x, id);
+        assign(qy[id], unit.y, id);
+        assign(qz[id], unit.z, id);
+        assign(qw[id], std::cos(half), id);
+    }
+
+    void setScale(int id, const glm::vec3& scale)
+    {
+        assign(sx[id], scale.x, id);
+        assign(sy[id], scale.y, id);
+        assign(sz[id], scale.z, id);
+    }
+
+    // recomposes the dirty objects; the count is what the last call redid
+    int update()
+    {
+        int composed = 0;
+        for (int first = 0; first < count; first += 4)
+        {
+            if (!(dirty[first] | dirty[first + 1] | dirty[first + 2] | dirty[first + 3]))
+                continue;
+            compose(first);
+            for (int i = first; i < first + 4 && i < count; i++)
+            {
+                composed += dirty[i];
+                dirty[i] = 0;
+            }
+        }
+        recomposed = composed;
+        return composed;
+    }
+
+    const glm::mat4& world(int id) const
+    {
+        return worlds[id];
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+    int recomposedLastUpdate() const
+    {
+        return recomposed;
+    }
+
+private:
+    int count = 0;
+    int recomposed = 0;
+    std::vector<float> px, py, pz;
+    std::vector<float> qx, qy, qz, qw;
+    std::vector<float> sx, sy, sz;
+    std::vector<unsigned char> dirty;
+    std::vector<glm::mat4> worlds;
+
+    void assign(float& component, float value, int id)
+    {
+        if (component == value)
+            return;
+        component = value;
+        dirty[id] = 1;
+    }
+
+    // objects first to first + 3
+    void compose(int first)
+    {
+#ifdef TRANSFORM_SSE
+        __m128 x = _mm_loadu_ps(&qx[first]), y = _mm_loadu_ps(&qy[first]), z = _mm_loadu_ps(&qz[first]), w = _mm_loadu_ps(&qw[first]);
+        __m128 one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+        __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+        __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+        __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+        // rotation[c][r], column c of the rotation matrix
+        __m128 rotation[3][3] = {
+            { _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), _mm_mul_ps(two, _mm_add_ps(xy, wz)), _mm_mul_ps(two, _mm_sub_ps(xz, wy)) },
+            { _mm_mul_ps(two, _mm_sub_ps(xy, wz)), _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), _mm_mul_ps(two, _mm_add_ps(yz, wx)) },
+            { _mm_mul_ps(two, _mm_add_ps(xz, wy)), _mm_mul_ps(two, _mm_sub_ps(yz, wx)), _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))) }
+        };
+        __m128 scale[3] = { _mm_loadu_ps(&sx[first]), _mm_loadu_ps(&sy[first]), _mm_loadu_ps(&sz[first]) };
+        for (int c = 0; c < 3; c++)
+        {
+            __m128 a = _mm_mul_ps(rotation[c][0], scale[c]);
+            __m128 b = _mm_mul_ps(rotation[c][1], scale[c]);
+            __m128 d = _mm_mul_ps(rotation[c][2], scale[c]);
+            __m128 e = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(a, b, d, e);
+            _mm_storeu_ps(&worlds[first][c][0], a);
+            _mm_storeu_ps(&worlds[first + 1][c][0], b);
+            _mm_storeu_ps(&worlds[first + 2][c][0], d);
+            _mm_storeu_ps(&worlds[first + 3][c][0], e);
+        }
+        __m128 a = _mm_loadu_ps(&px[first]), b = _mm_loadu_ps(&py[first]), d = _mm_loadu_ps(&pz[first]), e = one;
+        _MM_TRANSPOSE4_PS(a, b, d, e);
+        _mm_storeu_ps(&worlds[first][3][0], a);
+        _mm_storeu_ps(&worlds[first + 1][3][0], b);
+        _mm_storeu_ps(&worlds[first + 2][3][0], d);
+        _mm_storeu_ps(&worlds[first + 3][3][0], e);
+#else
+        for (int i = first; i < first + 4; i++)
+        {
+            float x = qx[i], y = qy[i], z = qz[i], w = qw[i];
+            glm::vec3 rotation[3] = {
+                glm::vec3(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y)),
+                glm::vec3(2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x)),
+                glm::vec3(2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y))
+            };
+            float scale[3] = { sx[i], sy[i], sz[i] };
+            for (int c = 0; c < 3; c++)
+                worlds[i][c] = glm::vec4(rotation[c] * scale[c], 0.0f);
+            worlds[i][3] = glm::vec4(px[i], py[i], pz[i], 1.0f);
+        }
+#endif
+    }
+};
+
+#endif /* transform_system_h */
@@ -2,22 +2,61 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoord;
+// material index, per vertex in the static batch and per instance for queued cubes
+layout (location = 3) in float aMaterial;
+// per-instance transform and tint, only fed by instanced batches
+layout (location = 7) in mat4 aInstanceModel;
+layout (location = 11) in vec4 aInstanceTint;
+// texture array layer, only fed by a static batch drawing from the array
+layout (location = 12) in float aLayer;
+// normal matrix of aInstanceModel, worked out on the CPU (transform_system.h)
+layout (location = 13) in mat3 aInstanceNormal;
 
 out vec3 Normal;
 out vec3 FragPos;
 out vec2 TexCoord;
+flat out float VertexMaterial;
+flat out vec4 InstanceTint;
+flat out float Layer;
+//distance in front of the camera, picks the light cluster (light_clusters.h)
+out float ViewDepth;
 
 
 uniform mat4 model;
+// transpose(inverse(mat3(model))), set by Shader along with model
+uniform mat3 normalMatrix;
 uniform mat4 view;
 uniform mat4 projection;
+uniform bool useInstancing;
+// the old per vertex inverse, only for comparing the two in a benchmark
+uniform bool invertInShader;
 
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0f);
+    mat4 world = model;
+    InstanceTint = vec4(1.0f);
+    //instanced draws leave model at the identity, their normal matrix comes along
+    if(useInstancing)
+    {
+        world = aInstanceModel * model;
+        InstanceTint = aInstanceTint;
+        Normal = aInstanceNormal * aNormal;
+    }
+    else if(invertInShader)
+    {
+        Normal = mat3(transpose(inverse(world))) * aNormal;
+    }
+    else
+    {
+        Normal = normalMatrix * aNormal;
+    }
 
-    FragPos = vec3(model * vec4(aPos, 1.0f));
+    gl_Position = projection * view * world * vec4(aPos, 1.0f);
+
+    FragPos = vec3(world * vec4(aPos, 1.0f));
+    ViewDepth = -(view * world * vec4(aPos, 1.0f)).z;
     TexCoord = aTexCoord;
 
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    VertexMaterial = aMaterial;
+    Layer = aLayer;
 }
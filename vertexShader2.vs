@@ -9,6 +9,8 @@ out vec3 Normal;
 out vec2 TexCoord;
 
 uniform mat4 model;
+// transpose(inverse(mat3(model))), set by Shader along with model
+uniform mat3 normalMatrix;
 uniform mat4 view;
 uniform mat4 projection;
 
@@ -17,6 +19,6 @@ void main()
     gl_Position = projection * view * model * vec4(aPos, 1.0f);
     
     FragPos = vec3(model * vec4(aPos, 1.0f));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    Normal = normalMatrix * aNormal;
     TexCoord = aTexCoord;
 }
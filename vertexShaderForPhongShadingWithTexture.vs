@@ -8,6 +8,8 @@ out vec3 Normal;
 out vec2 TexCoords;
 
 uniform mat4 model;
+// transpose(inverse(mat3(model))), set by Shader along with model
+uniform mat3 normalMatrix;
 uniform mat4 view;
 uniform mat4 projection;
 
@@ -16,7 +18,7 @@ void main()
     gl_Position = projection * view * model * vec4(aPos, 1.0);
     
     FragPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    Normal = normalMatrix * aNormal;
     TexCoords = aTexCoords;
     
 }
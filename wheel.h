@@ -13,6 +13,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "shader.h"
+#include "primitive_mesh.h"
 #include <GLFW/glfw3.h> // Include GLFW for handling input events
 
 using namespace std;
@@ -47,15 +48,8 @@ public:
         this->specular = spec;
         this->shininess = shiny;
 
-        setUpWheelVertexDataAndConfigureVertexAttribute();
-    }
-
-    // Destructor
-    ~Wheel()
-    {
-        glDeleteVertexArrays(1, &wheelVAO);
-        glDeleteBuffers(1, &wheelVBO);
-        glDeleteBuffers(1, &wheelEBO);
+        PrimitiveKey key = { PrimitiveKey::SPHERE, 36, 18, 1.0f, 0.0f };
+        mesh = PrimitiveMeshRegistry::shared().acquire(key, generateWheelVerticesAndIndices);
     }
 
     void draw(Shader& lightingShaderWithTexture, glm::mat4 model = glm::mat4(1.0f))
@@ -69,14 +63,13 @@ public:
         lightingShaderWithTexture.setFloat("material.shininess", this->shininess);
 
         // Bind diffuse map
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
         transform = positionMatrix * rotationMatrix * scaleMatrix;
         model = model * transform;
         lightingShaderWithTexture.setMat4("model", model);
 
-        glBindVertexArray(wheelVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
     }
     // Transformation setters
     void setPosition(glm::vec3 pos) {
@@ -90,6 +83,12 @@ public:
     void setRotation(float angle, glm::vec3 axis) {
         rotationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), axis);
     }
+
+    // world box of what draw(shader, model) covers
+    BoundingBox bounds(glm::mat4 model = glm::mat4(1.0f)) const
+    {
+        return mesh.bounds.transformed(model * positionMatrix * rotationMatrix * scaleMatrix);
+    }
     void drawColor(Shader& lightingShaderWithTexture, glm::mat4 model = glm::mat4(1.0f))
     {
         lightingShaderWithTexture.use();
@@ -97,28 +96,22 @@ public:
         lightingShaderWithTexture.setVec3("color", this->ambient);
 
         // Bind diffuse map
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, this->textureMap);
+        activeTexture(GL_TEXTURE0);
+        bindTexture(GL_TEXTURE_2D, this->textureMap);
 
         lightingShaderWithTexture.setMat4("model", model);
 
-        glBindVertexArray(wheelVAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        PrimitiveMeshRegistry::shared().draw(mesh);
     }
 
 private:
-    unsigned int wheelVAO;
-    unsigned int wheelVBO;
-    unsigned int wheelEBO;
-
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
+    PrimitiveMesh mesh;
 
-    void setUpWheelVertexDataAndConfigureVertexAttribute()
+    static void generateWheelVerticesAndIndices(const PrimitiveKey& key, std::vector<float>& vertices, std::vector<unsigned int>& indices)
     {
-        // Set up the wheel's vertex data, buffers, and configure vertex attributes
-        const int sectorCount = 36;
-        const int stackCount = 18;
+        // Set up the wheel's vertex data
+        const int sectorCount = key.sectors;
+        const int stackCount = key.stacks;
 
         for (int i = 0; i <= stackCount; ++i) {
             float stackAngle = glm::pi<float>() / 2 - i * glm::pi<float>() / stackCount;
@@ -156,27 +149,6 @@ private:
                 indices.push_back(first + 1);
             }
         }
-
-        glGenVertexArrays(1, &wheelVAO);
-        glGenBuffers(1, &wheelVBO);
-        glGenBuffers(1, &wheelEBO);
-
-        glBindVertexArray(wheelVAO);
-
-        glBindBuffer(GL_ARRAY_BUFFER, wheelVBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, wheelEBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)12);
-        glEnableVertexAttribArray(1);
-
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)24);
-        glEnableVertexAttribArray(2);
     }
 };
 #endif /* cube_h */
\ No newline at end of file